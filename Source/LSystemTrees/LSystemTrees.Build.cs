@@ -40,10 +40,18 @@ public class LSystemTrees : ModuleRules
 				"SlateCore",
 				"RenderCore",
 				"RHI",
+				"Json",
+				"MeshDescription",
+				"StaticMeshDescription",
 			}
 			);
 		
 		
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("DerivedDataCache");
+		}
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -0,0 +1,140 @@
+// TreeBenchmarkCommandlet.cpp
+// Command line driver for the generation pipeline benchmarks
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Commandlets/TreeBenchmarkCommandlet.h"
+#include "Core/Utilities/TreeBenchmark.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+/** Parse a comma separated integer list option (empty if the option is missing) */
+static TArray<int32> ParseIntList(const FString& Params, const TCHAR* Option)
+{
+	TArray<int32> Values;
+
+	FString Text;
+	if (FParse::Value(*Params, Option, Text, false))
+	{
+		TArray<FString> Parts;
+		Text.ParseIntoArray(Parts, TEXT(","));
+		for (const FString& Part : Parts)
+		{
+			Values.Add(FCString::Atoi(*Part));
+		}
+	}
+
+	return Values;
+}
+
+// ============================================================================
+// Constructor
+// ============================================================================
+
+UTreeBenchmarkCommandlet::UTreeBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+// ============================================================================
+// UCommandlet Interface
+// ============================================================================
+
+int32 UTreeBenchmarkCommandlet::Main(const FString& Params)
+{
+	TArray<FString> PresetFilter;
+	FString PresetText;
+	if (FParse::Value(*Params, TEXT("Presets="), PresetText, false))
+	{
+		PresetText.ParseIntoArray(PresetFilter, TEXT(","));
+	}
+
+	const TArray<int32> IterationCounts = ParseIntList(Params, TEXT("Iterations="));
+
+	TArray<int32> Seeds = ParseIntList(Params, TEXT("Seeds="));
+	if (Seeds.Num() == 0)
+	{
+		Seeds = { 1, 2, 3 };
+	}
+
+	int32 Repeats = 3;
+	FParse::Value(*Params, TEXT("Repeats="), Repeats);
+
+	int32 MaxStringLength = 10000000;
+	FParse::Value(*Params, TEXT("MaxLength="), MaxStringLength);
+
+	FString OutputBase = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LSystemTrees"), TEXT("Benchmarks"),
+	                                     FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+	FParse::Value(*Params, TEXT("Output="), OutputBase);
+
+	// Run every (preset, iterations, seed) case
+	TArray<FTreeBenchmarkResult> Results;
+	for (const FTreeBenchmarkPreset& Preset : FTreeBenchmark::GetBuiltinPresets())
+	{
+		if (PresetFilter.Num() > 0 && !PresetFilter.Contains(Preset.Name))
+		{
+			continue;
+		}
+
+		const TArray<int32> PresetIterations = IterationCounts.Num() > 0 ? IterationCounts : TArray<int32>{ Preset.Iterations };
+		for (int32 Iterations : PresetIterations)
+		{
+			for (int32 Seed : Seeds)
+			{
+				Results.Add(FTreeBenchmark::RunCase(Preset, Iterations, Seed, Repeats, MaxStringLength));
+			}
+		}
+	}
+
+	if (Results.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("TreeBenchmark: No cases to run"));
+		return 2;
+	}
+
+	const FString JsonPath = OutputBase + TEXT(".json");
+	const FString CsvPath = OutputBase + TEXT(".csv");
+	if (!FTreeBenchmark::SaveJson(Results, JsonPath) || !FTreeBenchmark::SaveCsv(Results, CsvPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("TreeBenchmark: Could not write results to %s"), *OutputBase);
+		return 2;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("TreeBenchmark: %d cases written to %s (.json, .csv)"), Results.Num(), *OutputBase);
+
+	// Regression check against a stored run
+	FString BaselinePath;
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		double Tolerance = 0.1;
+		FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+		TArray<FString> Regressions;
+		if (!FTreeBenchmark::CompareToBaseline(Results, BaselinePath, Tolerance, Regressions))
+		{
+			return 2;
+		}
+
+		for (const FString& Regression : Regressions)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("TreeBenchmark: Regression - %s"), *Regression);
+		}
+
+		if (Regressions.Num() > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TreeBenchmark: %d stage(s) slower than baseline by more than %.0f%%"),
+			       Regressions.Num(), Tolerance * 100.0);
+			return 1;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("TreeBenchmark: No regressions against %s"), *BaselinePath);
+	}
+
+	return 0;
+}
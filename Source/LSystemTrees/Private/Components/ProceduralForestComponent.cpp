@@ -0,0 +1,151 @@
+// ProceduralForestComponent.cpp
+// Instanced rendering of baked procedural trees
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Components/ProceduralForestComponent.h"
+#include "Components/ProceduralTreeComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+
+// ============================================================================
+// Constructor
+// ============================================================================
+
+UProceduralForestComponent::UProceduralForestComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+// ============================================================================
+// UActorComponent Interface
+// ============================================================================
+
+void UProceduralForestComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	ClearForest();
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+// ============================================================================
+// Instances
+// ============================================================================
+
+int32 UProceduralForestComponent::AddTreeInstance(UProceduralTreeComponent* Preset, int32 Seed,
+                                                  const FTransform& InstanceTransform, bool bWorldSpace)
+{
+	UHierarchicalInstancedStaticMeshComponent* Variant = FindOrCreateVariant(Preset, Seed);
+	if (!Variant)
+	{
+		return INDEX_NONE;
+	}
+
+	return Variant->AddInstance(InstanceTransform, bWorldSpace);
+}
+
+int32 UProceduralForestComponent::AddTreeInstances(UProceduralTreeComponent* Preset, int32 Seed,
+                                                   const TArray<FTransform>& InstanceTransforms, bool bWorldSpace)
+{
+	if (InstanceTransforms.Num() == 0)
+	{
+		return 0;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Variant = FindOrCreateVariant(Preset, Seed);
+	if (!Variant)
+	{
+		return 0;
+	}
+
+	Variant->AddInstances(InstanceTransforms, false, bWorldSpace);
+	return InstanceTransforms.Num();
+}
+
+void UProceduralForestComponent::ClearForest()
+{
+	for (UHierarchicalInstancedStaticMeshComponent* Variant : VariantComponents)
+	{
+		if (Variant)
+		{
+			Variant->DestroyComponent();
+		}
+	}
+
+	VariantComponents.Empty();
+	VariantIndices.Empty();
+}
+
+UHierarchicalInstancedStaticMeshComponent* UProceduralForestComponent::GetVariantComponent(UProceduralTreeComponent* Preset, int32 Seed)
+{
+	return FindOrCreateVariant(Preset, Seed);
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+int32 UProceduralForestComponent::GetVariantCount() const
+{
+	return VariantComponents.Num();
+}
+
+int32 UProceduralForestComponent::GetInstanceCount() const
+{
+	int32 Total = 0;
+	for (const UHierarchicalInstancedStaticMeshComponent* Variant : VariantComponents)
+	{
+		if (Variant)
+		{
+			Total += Variant->GetInstanceCount();
+		}
+	}
+	return Total;
+}
+
+// ============================================================================
+// Internal Methods
+// ============================================================================
+
+UHierarchicalInstancedStaticMeshComponent* UProceduralForestComponent::FindOrCreateVariant(UProceduralTreeComponent* Preset, int32 Seed)
+{
+	if (!Preset)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProceduralForestComponent: No preset tree given"));
+		return nullptr;
+	}
+
+	FVariantKey Key;
+	Key.Preset = Preset;
+	Key.Seed = Seed;
+
+	if (const int32* ExistingIndex = VariantIndices.Find(Key))
+	{
+		return VariantComponents[*ExistingIndex];
+	}
+
+	// First tree of this variant: generate and bake once, every further tree is just an instance
+	UStaticMesh* Mesh = Preset->BakeStaticMeshForSeed(Seed, BakeSettings, this);
+	if (!Mesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralForestComponent: Failed to bake variant (seed %d)"), Seed);
+		return nullptr;
+	}
+
+	UObject* ComponentOuter = GetOwner() ? static_cast<UObject*>(GetOwner()) : static_cast<UObject*>(this);
+	UHierarchicalInstancedStaticMeshComponent* Variant = NewObject<UHierarchicalInstancedStaticMeshComponent>(ComponentOuter);
+	Variant->SetStaticMesh(Mesh);
+	Variant->SetCollisionEnabled(BakeSettings.bBuildCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+	Variant->SetupAttachment(this);
+
+	if (GetWorld())
+	{
+		Variant->RegisterComponent();
+	}
+
+	const int32 NewIndex = VariantComponents.Add(Variant);
+	VariantIndices.Add(Key, NewIndex);
+
+	UE_LOG(LogTemp, Log, TEXT("ProceduralForestComponent: Baked variant %d (seed %d)"), NewIndex, Seed);
+
+	return Variant;
+}
@@ -6,7 +6,22 @@
 #include "Core/LSystem/LSystemGenerator.h"
 #include "Core/TreeGeometry/TurtleInterpreter.h"
 #include "Core/TreeGeometry/TreeGeometry.h"
+#include "Core/TreeGeometry/TreeMeshBaker.h"
 #include "Core/Utilities/DebugDraw.h"
+#include "Core/Utilities/TreeMath.h"
+#include "Core/Utilities/TreeStats.h"
+#include "Subsystems/TreeGenerationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Async/Async.h"
+#include "Misc/ScopeExit.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
 
 // ============================================================================
 // Constructor
@@ -18,14 +33,38 @@ UProceduralTreeComponent::UProceduralTreeComponent(const FObjectInitializer& Obj
 	, Iterations(4)
 	, RandomSeed(0)
 	, bRandomizeSeed(true)
+	, bAutoLOD(false)
+	, LODUpdateInterval(0.1f)
 	, bGenerateOnStart(false)
+	, bStreamFinalIteration(false)
+	, bUseGenerationCache(true)
+	, bUseGenerationScheduler(true)
+	, PlaceholderMesh(nullptr)
 	, BarkMaterial(nullptr)
 	, LeafMaterial(nullptr)
+	, bInstancedLeaves(false)
+	, LeafCardMesh(nullptr)
+	, LeafCullDistance(0.0f)
 	, Generator(nullptr)
 	, Interpreter(nullptr)
 	, GeometryBuilder(nullptr)
+	, LeafInstances(nullptr)
+	, PlaceholderComponent(nullptr)
+	, CapsuleBodySetup(nullptr)
+	, bCapsuleCollision(false)
+	, bTriangleCollision(false)
 	, CurrentLODIndex(0)
+	, CachedData(FTreeGeneratedData::GetEmpty())
+	, AppliedSeed(0)
+	, bRetainSeed(false)
+	, bScheduledGeneration(false)
 {
+	// Ticking is only enabled while automatic LOD selection is active
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickInterval = LODUpdateInterval;
+	bTickInEditor = true;
+
 	// Set up default 3D tree rule with pitch variations for depth
 	// Uses ^ (pitch up) and & (pitch down) for 3D growth
 	// Uses / and \ (roll) for branch rotation variety
@@ -55,8 +94,48 @@ void UProceduralTreeComponent::BeginPlay()
 
 	if (bGenerateOnStart)
 	{
-		GenerateTree();
+		if (bUseGenerationScheduler)
+		{
+			RequestScheduledGeneration();
+		}
+		else
+		{
+			GenerateTree();
+		}
+	}
+}
+
+void UProceduralTreeComponent::TickComponent(float DeltaTime, ELevelTick TickType,
+                                             FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bAutoLOD)
+	{
+		UpdateAutoLOD();
+	}
+}
+
+void UProceduralTreeComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	// In-flight worker stages finish on their own objects; just make sure nothing is applied
+	CancelTreeGeneration();
+
+	if (LeafInstances)
+	{
+		LeafInstances->DestroyComponent();
+		LeafInstances = nullptr;
+	}
+
+	if (PlaceholderComponent)
+	{
+		PlaceholderComponent->DestroyComponent();
+		PlaceholderComponent = nullptr;
 	}
+
+	ReleaseGenerationBreakdown();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
 }
 
 #if WITH_EDITOR
@@ -67,7 +146,8 @@ void UProceduralTreeComponent::PostEditChangeProperty(FPropertyChangedEvent& Pro
 	// Auto-regenerate tree when properties change in editor
 	if (PropertyChangedEvent.Property != nullptr)
 	{
-		const FName PropertyName = PropertyChangedEvent.Property->GetFName();
+		// The component member that contains the edit (nested struct/array fields report their own leaf name)
+		const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
 
 		// List of properties that should trigger regeneration
 		static const TSet<FName> RegenerateProperties = {
@@ -76,141 +156,520 @@ void UProceduralTreeComponent::PostEditChangeProperty(FPropertyChangedEvent& Pro
 			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, Iterations),
 			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, RandomSeed),
 			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, bRandomizeSeed),
+			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, bStreamFinalIteration),
 			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, TurtleConfig),
 			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, GeometryConfig),
-			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LODLevels)
+			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LODLevels),
+			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, bInstancedLeaves)
 		};
 
 		// Regenerate if relevant property changed
 		if (RegenerateProperties.Contains(PropertyName))
 		{
+			// Editing anything but the seed keeps the current tree's seed so unchanged stages can be reused
+			bRetainSeed = PropertyName != GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, RandomSeed) &&
+			              PropertyName != GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, bRandomizeSeed);
 			GenerateTree();
 		}
 
+		// Automatic LOD toggles only affect ticking
+		if (PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, bAutoLOD) ||
+		    PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LODUpdateInterval))
+		{
+			UpdateAutoLODTick();
+		}
+
 		// Apply materials if material properties changed
 		if (PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, BarkMaterial) ||
 		    PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LeafMaterial))
 		{
 			ApplyMaterials();
 		}
+
+		// Leaf card changes only rebuild the instances
+		if (PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LeafCardMesh) ||
+		    PropertyName == GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, LeafCullDistance))
+		{
+			UpdateLeafInstances();
+			UpdateLODVisibility();
+		}
 	}
 }
 #endif
 
 // ============================================================================
-// Generation Methods
+// UPrimitiveComponent Interface
 // ============================================================================
 
-void UProceduralTreeComponent::GenerateTree()
+UBodySetup* UProceduralTreeComponent::GetBodySetup()
 {
-	// Ensure generators are initialized
-	InitializeGenerators();
-
-	if (!Generator || !Interpreter || !GeometryBuilder)
+	if (bCapsuleCollision && CapsuleBodySetup)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: Failed to initialize generators"));
-		OnTreeGenerated.Broadcast(false);
-		return;
+		return CapsuleBodySetup;
 	}
+	return Super::GetBodySetup();
+}
+
+// ============================================================================
+// Pipeline Stages
+// ============================================================================
 
-	// Clear previous data
-	ClearTree();
-	CachedSegments.Empty();
-	CachedLeaves.Empty();
-	CachedLODs.Empty();
+/** Share of the leaf cull distance over which instances fade out before they are culled */
+static constexpr float LeafCullFadeFraction = 0.2f;
 
-	// Compute effective random seed
-	int32 EffectiveSeed = RandomSeed;
-	if (bRandomizeSeed)
+/** Bump whenever the pipeline output changes for identical inputs (invalidates cached trees) */
+static constexpr uint32 TreeGenerationCacheVersion = 1;
+
+/** Finish a SHA-1 hash into a key */
+static FSHAHash FinishKey(FSHA1& Hasher)
+{
+	Hasher.Final();
+
+	FSHAHash Key;
+	Hasher.GetHash(Key.Hash);
+	return Key;
+}
+
+void FTreeGenerationRequest::ComputeKeys()
+{
+	// Stage 1 inputs
 	{
-		// Generate a truly random seed using FMath::Rand()
-		// This ensures every tree is unique, even at the same location
-		EffectiveSeed = FMath::Rand();
+		FSHA1 Hasher;
+		FTreeGenerationCache::HashValue(Hasher, TreeGenerationCacheVersion);
+		FTreeGenerationCache::HashString(Hasher, Axiom);
 
-		// Ensure non-zero seed
-		if (EffectiveSeed == 0)
+		FTreeGenerationCache::HashValue(Hasher, Rules.Num());
+		for (const FLSystemRule& Rule : Rules)
 		{
-			EffectiveSeed = 1;
+			FTreeGenerationCache::HashStruct(Hasher, FLSystemRule::StaticStruct(), &Rule);
 		}
 
-		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Random seed: %d"), EffectiveSeed);
+		FTreeGenerationCache::HashValue(Hasher, Iterations);
+		FTreeGenerationCache::HashValue(Hasher, Seed);
+		LSystemKey = FinishKey(Hasher);
 	}
 
-	// Report progress: Step 1 - L-System Generation
-	OnGenerationProgress.Broadcast(1, 4);
+	// Stage 2 inputs: the symbols plus the turtle settings
+	{
+		FSHA1 Hasher;
+		FTreeGenerationCache::HashValue(Hasher, LSystemKey.Hash);
+		FTreeGenerationCache::HashValue(Hasher, static_cast<uint8>(bStreamFinalIteration ? 1 : 0));
+		FTreeGenerationCache::HashStruct(Hasher, FTurtleConfig::StaticStruct(), &TurtleConfig);
+		TurtleKey = FinishKey(Hasher);
+	}
+
+	// Stage 3 inputs: the skeleton plus the geometry settings (identifies the whole tree)
+	{
+		// Collision is built from the skeleton and LOD 0 when a tree is applied, so it never changes the data
+		const FTreeGeometryConfig Defaults;
+		FTreeGeometryConfig MeshConfig = GeometryConfig;
+		MeshConfig.bGenerateCollision = Defaults.bGenerateCollision;
+		MeshConfig.CollisionMode = Defaults.CollisionMode;
+		MeshConfig.CollisionMaxDepth = Defaults.CollisionMaxDepth;
+		MeshConfig.CollisionMinRadius = Defaults.CollisionMinRadius;
+		MeshConfig.MaxCollisionCapsules = Defaults.MaxCollisionCapsules;
+
+		FSHA1 Hasher;
+		FTreeGenerationCache::HashValue(Hasher, TurtleKey.Hash);
+		FTreeGenerationCache::HashStruct(Hasher, FTreeGeometryConfig::StaticStruct(), &MeshConfig);
+
+		FTreeGenerationCache::HashValue(Hasher, LODLevels.Num());
+		for (const FTreeLODLevel& LODLevel : LODLevels)
+		{
+			FTreeGenerationCache::HashStruct(Hasher, FTreeLODLevel::StaticStruct(), &LODLevel);
+		}
+		CacheKey = FinishKey(Hasher);
+	}
+}
+
+/**
+ * Shared state of one GenerateTreeAsync call.
+ * The pipeline objects are private to the task (rooted until the game thread completion),
+ * so overlapping requests and component destruction never race on shared instances.
+ */
+struct FTreeGenerationTask
+{
+	FTreeGenerationRequest Request;
+	FTreeGenerationOutput Output;
+
+	ULSystemGenerator* Generator = nullptr;
+	UTurtleInterpreter* Interpreter = nullptr;
+	UTreeGeometry* GeometryBuilder = nullptr;
+
+	/** Set from the game thread to stop at the next stage boundary */
+	TAtomic<bool> bCancelled;
+
+	/** Set by a stage that failed (read after the stage completed) */
+	bool bFailed;
+
+	/** Started by UTreeGenerationSubsystem, which also applies the result */
+	bool bScheduled;
+
+	/** Try the persistent cache on the worker before running any stage */
+	bool bLoadPersistent;
+
+	/** Tree found in the persistent cache (the stages are then skipped) */
+	FTreeGeneratedDataPtr PersistedData;
+
+	FTreeGenerationTask()
+		: bCancelled(false)
+		, bFailed(false)
+		, bScheduled(false)
+		, bLoadPersistent(false)
+	{
+	}
+
+	bool ShouldContinue() const
+	{
+		return !bCancelled && !bFailed && !PersistedData.IsValid();
+	}
+
+	/** Create and root the pipeline objects (game thread) */
+	void CreateObjects()
+	{
+		Generator = NewObject<ULSystemGenerator>(GetTransientPackage());
+		Interpreter = NewObject<UTurtleInterpreter>(GetTransientPackage());
+		GeometryBuilder = NewObject<UTreeGeometry>(GetTransientPackage());
+
+		Generator->AddToRoot();
+		Interpreter->AddToRoot();
+		GeometryBuilder->AddToRoot();
+	}
+
+	/** Let GC collect the pipeline objects (game thread, after all stages finished) */
+	void ReleaseObjects()
+	{
+		Generator->RemoveFromRoot();
+		Interpreter->RemoveFromRoot();
+		GeometryBuilder->RemoveFromRoot();
+
+		Generator = nullptr;
+		Interpreter = nullptr;
+		GeometryBuilder = nullptr;
+	}
+};
+
+/** Stage 1: Generate the L-System symbols (and interpret them too when streaming) */
+static bool RunLSystemStage(const FTreeGenerationRequest& Request, ULSystemGenerator* Generator,
+                            UTurtleInterpreter* Interpreter, FTreeGenerationOutput& Output)
+{
+	// Reused from the previous generation (only downstream settings changed)
+	if (Output.bHasSymbols || Output.bInterpreted)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Reusing L-System symbols"));
+		return true;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_LSystemStage);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::LSystemStage);
+	const double StartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		Output.LSystemTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	};
 
-	// Step 1: Generate L-System string
 	Generator->Reset();
-	Generator->Initialize(Axiom);
+	Generator->Initialize(Request.Axiom);
 
 	// Add all rules
-	for (const FLSystemRule& Rule : Rules)
+	for (const FLSystemRule& Rule : Request.Rules)
 	{
 		Generator->AddRule(Rule);
 	}
 
 	// Set random seed
-	Generator->SetRandomSeed(EffectiveSeed);
+	Generator->SetRandomSeed(Request.Seed);
+
+	if (Request.bStreamFinalIteration)
+	{
+		// Steps 1+2 fused: the turtle consumes the final iteration while it is being rewritten
+		Interpreter->BeginStream(Request.TurtleConfig, Output.Skeleton);
+
+		FLSystemGenerationResult GenResult = Generator->GenerateStreamed(Request.Iterations,
+			[Interpreter](const uint8* Symbols, int32 Count)
+			{
+				Interpreter->ProcessSymbols(Symbols, Count);
+			});
+
+		Interpreter->EndStream();
+		Output.bInterpreted = true;
+
+		if (!GenResult.bSuccess)
+		{
+			Output.ErrorMessage = FString::Printf(TEXT("L-System generation failed: %s"), *GenResult.ErrorMessage);
+			return false;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Streamed L-System string with %d characters"), GenResult.Stats.FinalStringLength);
+		return true;
+	}
 
 	// Generate the string
-	FLSystemGenerationResult GenResult = Generator->Generate(Iterations);
+	FLSystemGenerationResult GenResult = Generator->GenerateSymbols(Request.Iterations);
 	if (!GenResult.bSuccess)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: L-System generation failed: %s"), *GenResult.ErrorMessage);
+		Output.ErrorMessage = FString::Printf(TEXT("L-System generation failed: %s"), *GenResult.ErrorMessage);
+		return false;
+	}
+
+	Output.Symbols = MoveTemp(GenResult.Symbols);
+	Output.bHasSymbols = true;
+
+	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Generated L-System string with %d characters"), Output.Symbols.Num());
+	return true;
+}
+
+/** Stage 2: Interpret the symbols with the turtle (no-op if already done while streaming) */
+static void RunTurtleStage(const FTreeGenerationRequest& Request, UTurtleInterpreter* Interpreter,
+                           FTreeGenerationOutput& Output)
+{
+	if (!Output.bInterpreted)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_TurtleStage);
+		TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::TurtleStage);
+		const double StartTime = FPlatformTime::Seconds();
+
+		Interpreter->InterpretSymbolsToSkeleton(Output.Symbols, Request.TurtleConfig, Output.Skeleton);
+		Output.bInterpreted = true;
+
+		Output.TurtleTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Created %d segments and %d leaves"),
+	       Output.Skeleton.NumSegments(), Output.Skeleton.NumLeaves());
+}
+
+/** Stage 3: Generate mesh geometry for all LOD levels */
+static bool RunGeometryStage(const FTreeGenerationRequest& Request, UTreeGeometry* GeometryBuilder,
+                             FTreeGenerationOutput& Output)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_GeometryStage);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::GeometryStage);
+	const double StartTime = FPlatformTime::Seconds();
+
+	GeometryBuilder->BarkUVTiling = Request.GeometryConfig.BarkUVTiling;
+	GeometryBuilder->DefaultLeafSize = Request.GeometryConfig.LeafSize;
+	GeometryBuilder->bSmoothNormals = Request.GeometryConfig.bSmoothNormals;
+
+	Output.LODs = GeometryBuilder->GenerateMeshLODsFromSkeleton(Output.Skeleton, Request.LODLevels);
+	Output.GeometryTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	if (Output.LODs.Num() == 0)
+	{
+		Output.ErrorMessage = TEXT("Failed to generate mesh LODs");
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Generated %d LOD levels"), Output.LODs.Num());
+	return true;
+}
+
+// ============================================================================
+// Generation Methods
+// ============================================================================
+
+void UProceduralTreeComponent::GenerateTree()
+{
+	// Ensure generators are initialized
+	InitializeGenerators();
+
+	if (!Generator || !Interpreter || !GeometryBuilder)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: Failed to initialize generators"));
 		OnTreeGenerated.Broadcast(false);
 		return;
 	}
 
-	CachedLSystemString = GenResult.GeneratedString;
+	// A synchronous generation supersedes any pending async one
+	CancelTreeGeneration();
+
+	FTreeGenerationRequest Request;
+	BuildGenerationRequest(Request);
+
+	// Identical inputs were generated before - share the result instead of rerunning the pipeline
+	if (FTreeGeneratedDataPtr Cached = FindCachedGeneration(Request, true))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Generation cache hit (seed %d)"), Request.Seed);
+		ApplyGeneratedData(Request, Cached);
+		return;
+	}
+
+	// Carry over the stages whose inputs did not change
+	FTreeGenerationOutput Output;
+	PrepareIncrementalOutput(Request, Output);
+
+	// Release previous data (the mesh itself is kept so an unchanged topology can be updated in place)
+	CachedData = FTreeGeneratedData::GetEmpty();
 
-	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Generated L-System string with %d characters"), CachedLSystemString.Len());
+	// Report progress: Step 1 - L-System Generation
+	OnGenerationProgress.Broadcast(1, 4);
+
+	// Step 1: Generate L-System string
+	if (!RunLSystemStage(Request, Generator, Interpreter, Output))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: %s"), *Output.ErrorMessage);
+		ClearTree();
+		OnTreeGenerated.Broadcast(false);
+		return;
+	}
 
 	// Report progress: Step 2 - Turtle Interpretation
 	OnGenerationProgress.Broadcast(2, 4);
 
 	// Step 2: Interpret string with turtle
-	FTurtleConfig InterpretConfig = TurtleConfig;
-	InterpretConfig.RandomSeed = EffectiveSeed;
-	InterpretConfig.LeafSize = GeometryConfig.LeafSize;
-
-	Interpreter->InterpretString(CachedLSystemString, InterpretConfig, CachedSegments, CachedLeaves);
-
-	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Created %d segments and %d leaves"),
-	       CachedSegments.Num(), CachedLeaves.Num());
+	RunTurtleStage(Request, Interpreter, Output);
 
 	// Report progress: Step 3 - Geometry Generation
 	OnGenerationProgress.Broadcast(3, 4);
 
 	// Step 3: Generate mesh geometry for all LOD levels
-	if (LODLevels.Num() == 0)
+	if (!RunGeometryStage(Request, GeometryBuilder, Output))
 	{
-		InitializeDefaultLODs();
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: %s"), *Output.ErrorMessage);
+		ClearTree();
+		OnTreeGenerated.Broadcast(false);
+		return;
 	}
 
-	GeometryBuilder->BarkUVTiling = GeometryConfig.BarkUVTiling;
-	GeometryBuilder->DefaultLeafSize = GeometryConfig.LeafSize;
+	// Report progress: Step 4 - Apply Mesh
+	OnGenerationProgress.Broadcast(4, 4);
+
+	// Step 4: Apply the highest detail LOD to the mesh
+	ApplyGenerationOutput(Request, Output);
+}
+
+void UProceduralTreeComponent::GenerateTreeAsync()
+{
+	CancelTreeGeneration();
 
-	CachedLODs = GeometryBuilder->GenerateMeshLODs(CachedSegments, CachedLeaves, LODLevels);
+	FTreeGenerationRequest Request;
+	BuildGenerationRequest(Request);
 
-	if (CachedLODs.Num() == 0)
+	// Memory cache hits complete immediately, no tasks needed
+	if (FTreeGeneratedDataPtr Cached = FindCachedGeneration(Request, false))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: Failed to generate mesh LODs"));
-		OnTreeGenerated.Broadcast(false);
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Generation cache hit (seed %d)"), Request.Seed);
+		ApplyGeneratedData(Request, Cached);
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Generated %d LOD levels"), CachedLODs.Num());
+	LaunchAsyncGeneration(Request, false);
+}
 
-	// Report progress: Step 4 - Apply Mesh
-	OnGenerationProgress.Broadcast(4, 4);
+void UProceduralTreeComponent::RequestScheduledGeneration()
+{
+	UTreeGenerationSubsystem* Scheduler = GetGenerationScheduler();
+	if (!Scheduler)
+	{
+		GenerateTreeAsync();
+		return;
+	}
 
-	// Step 4: Apply the highest detail LOD to the mesh
-	CurrentLODIndex = 0;
-	ApplyMeshData(CachedLODs[CurrentLODIndex]);
-	ApplyMaterials();
+	// Requeue from scratch; the scheduler starts the pipeline itself once the tree's turn comes
+	CancelTreeGeneration();
+	Scheduler->EnqueueTree(this);
+	UpdatePlaceholder(true);
+}
 
-	// Broadcast completion
-	OnTreeGenerated.Broadcast(true);
+void UProceduralTreeComponent::LaunchAsyncGeneration(const FTreeGenerationRequest& Request, bool bScheduled)
+{
+	CancelActiveGeneration();
+
+	TSharedPtr<FTreeGenerationTask, ESPMode::ThreadSafe> Task = MakeShared<FTreeGenerationTask, ESPMode::ThreadSafe>();
+	Task->Request = Request;
+	Task->bScheduled = bScheduled;
+	Task->bLoadPersistent = bUseGenerationCache && Request.bPersistent && FTreeGenerationDiskCache::IsEnabled();
+
+	PrepareIncrementalOutput(Task->Request, Task->Output);
+	Task->CreateObjects();
+
+	ActiveGeneration = Task;
+
+	// Stage 1 -> Stage 2 -> Stage 3 on task graph workers; each stage is skipped once cancelled or failed
+	UE::Tasks::FTask LSystemTask = UE::Tasks::Launch(TEXT("TreeLSystemStage"), [Task]()
+	{
+		// Generated in an earlier session - loaded here so the disk IO never blocks the game thread
+		if (Task->bLoadPersistent && !Task->bCancelled)
+		{
+			Task->PersistedData = FTreeGenerationDiskCache::Load(Task->Request.CacheKey);
+		}
+
+		if (Task->ShouldContinue())
+		{
+			Task->bFailed = !RunLSystemStage(Task->Request, Task->Generator, Task->Interpreter, Task->Output);
+		}
+	});
+
+	UE::Tasks::FTask TurtleTask = UE::Tasks::Launch(TEXT("TreeTurtleStage"), [Task]()
+	{
+		if (Task->ShouldContinue())
+		{
+			RunTurtleStage(Task->Request, Task->Interpreter, Task->Output);
+		}
+	}, UE::Tasks::Prerequisites(LSystemTask));
+
+	TWeakObjectPtr<UProceduralTreeComponent> WeakThis(this);
+	UE::Tasks::Launch(TEXT("TreeGeometryStage"), [Task, WeakThis]()
+	{
+		if (Task->ShouldContinue())
+		{
+			Task->bFailed = !RunGeometryStage(Task->Request, Task->GeometryBuilder, Task->Output);
+		}
+
+		// Only the final mesh upload is marshalled to the game thread
+		AsyncTask(ENamedThreads::GameThread, [Task, WeakThis]()
+		{
+			if (UProceduralTreeComponent* This = WeakThis.Get())
+			{
+				This->FinishAsyncGeneration(Task);
+			}
+			Task->ReleaseObjects();
+		});
+	}, UE::Tasks::Prerequisites(TurtleTask));
+
+	UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Started async generation (seed %d)"), Task->Request.Seed);
+}
+
+void UProceduralTreeComponent::CancelTreeGeneration()
+{
+	if (UTreeGenerationSubsystem* Scheduler = GetGenerationScheduler())
+	{
+		Scheduler->DequeueTree(this);
+	}
+	UpdatePlaceholder(false);
+
+	CancelActiveGeneration();
+}
+
+void UProceduralTreeComponent::CancelActiveGeneration()
+{
+	if (!ActiveGeneration.IsValid())
+	{
+		return;
+	}
+
+	ActiveGeneration->bCancelled = true;
+
+	// Stop the L-System stage between iterations if it is running right now
+	if (ActiveGeneration->Generator)
+	{
+		ActiveGeneration->Generator->CancelAsyncGeneration();
+	}
+
+	ActiveGeneration.Reset();
+
+	UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Async generation cancelled"));
+}
+
+bool UProceduralTreeComponent::IsGeneratingTree() const
+{
+	if (ActiveGeneration.IsValid())
+	{
+		return true;
+	}
+
+	const UTreeGenerationSubsystem* Scheduler = GetGenerationScheduler();
+	return Scheduler && Scheduler->IsTreeScheduled(this);
 }
 
 void UProceduralTreeComponent::RegenerateWithSeed(int32 Seed)
@@ -221,8 +680,25 @@ void UProceduralTreeComponent::RegenerateWithSeed(int32 Seed)
 
 void UProceduralTreeComponent::ClearTree()
 {
+	// Fall back to the (now empty) mesh body setup
+	bCapsuleCollision = false;
+	bTriangleCollision = false;
+
 	ClearAllMeshSections();
+	if (LeafInstances)
+	{
+		LeafInstances->ClearInstances();
+	}
 	CurrentLODIndex = 0;
+	SetComponentTickEnabled(false);
+
+	// Drop the data itself too, so queries, LOD switches and the stats all see an empty component
+	CachedData = FTreeGeneratedData::GetEmpty();
+	AppliedLSystemKey = FSHAHash();
+	AppliedTurtleKey = FSHAHash();
+	AppliedCacheKey = FSHAHash();
+	AppliedSeed = 0;
+	ReleaseGenerationBreakdown();
 }
 
 // ============================================================================
@@ -231,19 +707,40 @@ void UProceduralTreeComponent::ClearTree()
 
 void UProceduralTreeComponent::SetLODLevel(int32 LODIndex)
 {
-	if (CachedLODs.Num() == 0)
+	// A manual choice wins over automatic selection
+	if (bAutoLOD)
+	{
+		SetAutoLOD(false);
+	}
+
+	ApplyLODLevel(LODIndex);
+}
+
+void UProceduralTreeComponent::SetAutoLOD(bool bEnable)
+{
+	bAutoLOD = bEnable;
+	UpdateAutoLODTick();
+
+	if (bAutoLOD)
+	{
+		UpdateAutoLOD();
+	}
+}
+
+void UProceduralTreeComponent::ApplyLODLevel(int32 LODIndex)
+{
+	if (CachedData->LODs.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ProceduralTreeComponent: No LODs available. Generate tree first."));
 		return;
 	}
 
-	const int32 ClampedIndex = FMath::Clamp(LODIndex, 0, CachedLODs.Num() - 1);
+	const int32 ClampedIndex = FMath::Clamp(LODIndex, 0, CachedData->LODs.Num() - 1);
 
 	if (ClampedIndex != CurrentLODIndex)
 	{
 		CurrentLODIndex = ClampedIndex;
-		ApplyMeshData(CachedLODs[CurrentLODIndex]);
-		ApplyMaterials();
+		UpdateLODVisibility();
 
 		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Switched to LOD %d"), CurrentLODIndex);
 	}
@@ -256,46 +753,108 @@ int32 UProceduralTreeComponent::GetCurrentLODLevel() const
 
 int32 UProceduralTreeComponent::GetLODCount() const
 {
-	return CachedLODs.Num();
+	return CachedData->LODs.Num();
 }
 
 // ============================================================================
-// Statistics
+// Baking
 // ============================================================================
 
-FString UProceduralTreeComponent::GetLSystemString() const
+UStaticMesh* UProceduralTreeComponent::BakeToStaticMesh(const FTreeBakeSettings& Settings, UObject* Outer)
 {
-	return CachedLSystemString;
-}
+	if (CachedData->LODs.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProceduralTreeComponent: No LODs to bake. Generate tree first."));
+		return nullptr;
+	}
 
-int32 UProceduralTreeComponent::GetBranchSegmentCount() const
-{
-	return CachedSegments.Num();
+	return UTreeMeshBaker::BakeStaticMesh(Outer, CachedData->LODs, LODLevels, BarkMaterial, LeafMaterial, Settings);
 }
 
-int32 UProceduralTreeComponent::GetLeafCount() const
+UStaticMesh* UProceduralTreeComponent::BakeStaticMeshForSeed(int32 Seed, const FTreeBakeSettings& Settings, UObject* Outer)
 {
-	return CachedLeaves.Num();
-}
+	InitializeGenerators();
+
+	if (!Generator || !Interpreter || !GeometryBuilder)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: Failed to initialize generators"));
+		return nullptr;
+	}
+
+	// Same settings as GenerateTree, but with the variant's seed
+	FTreeGenerationRequest Request;
+	BuildGenerationRequest(Request);
+	Request.Seed = Seed;
+	Request.bPersistent = true;
+	Request.TurtleConfig.RandomSeed = Seed;
+	Request.ComputeKeys();
+
+	if (FTreeGeneratedDataPtr Cached = FindCachedGeneration(Request, true))
+	{
+		return UTreeMeshBaker::BakeStaticMesh(Outer, Cached->LODs, Request.LODLevels, BarkMaterial, LeafMaterial, Settings);
+	}
+
+	FTreeGenerationOutput Output;
+	if (!RunLSystemStage(Request, Generator, Interpreter, Output))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: %s"), *Output.ErrorMessage);
+		return nullptr;
+	}
+
+	RunTurtleStage(Request, Interpreter, Output);
+
+	if (!RunGeometryStage(Request, GeometryBuilder, Output))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: %s"), *Output.ErrorMessage);
+		return nullptr;
+	}
+
+	FTreeGeneratedDataPtr Data = PublishGenerationOutput(Request, Output);
+	return UTreeMeshBaker::BakeStaticMesh(Outer, Data->LODs, Request.LODLevels, BarkMaterial, LeafMaterial, Settings);
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+FString UProceduralTreeComponent::GetLSystemString() const
+{
+	return CachedData->Symbols.ToString();
+}
+
+int32 UProceduralTreeComponent::GetBranchSegmentCount() const
+{
+	return CachedData->Skeleton.NumSegments();
+}
+
+int32 UProceduralTreeComponent::GetLeafCount() const
+{
+	return CachedData->Skeleton.NumLeaves();
+}
 
 int32 UProceduralTreeComponent::GetVertexCount() const
 {
-	if (CurrentLODIndex >= 0 && CurrentLODIndex < CachedLODs.Num())
+	if (CurrentLODIndex >= 0 && CurrentLODIndex < CachedData->LODs.Num())
 	{
-		return CachedLODs[CurrentLODIndex].GetVertexCount();
+		return CachedData->LODs[CurrentLODIndex].GetVertexCount();
 	}
 	return 0;
 }
 
 int32 UProceduralTreeComponent::GetTriangleCount() const
 {
-	if (CurrentLODIndex >= 0 && CurrentLODIndex < CachedLODs.Num())
+	if (CurrentLODIndex >= 0 && CurrentLODIndex < CachedData->LODs.Num())
 	{
-		return CachedLODs[CurrentLODIndex].GetTriangleCount();
+		return CachedData->LODs[CurrentLODIndex].GetTriangleCount();
 	}
 	return 0;
 }
 
+FTreeGenerationBreakdown UProceduralTreeComponent::GetLastGenerationBreakdown() const
+{
+	return LastGenerationBreakdown;
+}
+
 // ============================================================================
 // Debug
 // ============================================================================
@@ -303,18 +862,11 @@ int32 UProceduralTreeComponent::GetTriangleCount() const
 void UProceduralTreeComponent::DrawDebug(float Duration)
 {
 #if !UE_BUILD_SHIPPING
-	if (CachedSegments.Num() > 0)
-	{
-		UTreeDebugDraw::DrawBranchSegments(this, CachedSegments, Duration, true);
-	}
-
-	if (CachedLeaves.Num() > 0)
-	{
-		UTreeDebugDraw::DrawLeaves(this, CachedLeaves, Duration);
-	}
+	// Draw straight from the skeleton arrays (one batched, capped submission)
+	UTreeDebugDraw::DrawSkeleton(this, CachedData->Skeleton, GetComponentTransform(), Duration, true, true);
 
 	// Print string stats
-	UTreeDebugDraw::PrintLSystemString(CachedLSystemString, 500);
+	UTreeDebugDraw::PrintLSystemString(GetLSystemString(), 500);
 #endif
 }
 
@@ -338,6 +890,7 @@ void UProceduralTreeComponent::InitializeDefaultLODs()
 	LOD1.RadialSegments = 8;
 	LOD1.ScreenSize = 0.5f;
 	LOD1.bIncludeLeaves = true;
+	LOD1.MergeAngleThreshold = 5.0f;
 	LODLevels.Add(LOD1);
 
 	// LOD 2: Low detail
@@ -345,9 +898,328 @@ void UProceduralTreeComponent::InitializeDefaultLODs()
 	LOD2.RadialSegments = 4;
 	LOD2.ScreenSize = 0.25f;
 	LOD2.bIncludeLeaves = false;
+	LOD2.MergeAngleThreshold = 15.0f;
+	LOD2.MinBranchRadius = 1.0f;
+	LOD2.MinBranchLength = 30.0f;
+	LOD2.bReplacePrunedWithCards = true;
 	LODLevels.Add(LOD2);
 }
 
+void UProceduralTreeComponent::BuildGenerationRequest(FTreeGenerationRequest& OutRequest)
+{
+	// Compute effective random seed
+	int32 EffectiveSeed = RandomSeed;
+	if (bRandomizeSeed && bRetainSeed && AppliedSeed != 0)
+	{
+		// Keep the displayed tree's seed (set for edits that don't touch the seed)
+		EffectiveSeed = AppliedSeed;
+	}
+	else if (bRandomizeSeed)
+	{
+		// Generate a truly random seed using FMath::Rand()
+		// This ensures every tree is unique, even at the same location
+		EffectiveSeed = FMath::Rand();
+
+		// Ensure non-zero seed
+		if (EffectiveSeed == 0)
+		{
+			EffectiveSeed = 1;
+		}
+
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Random seed: %d"), EffectiveSeed);
+	}
+	bRetainSeed = false;
+
+	if (LODLevels.Num() == 0)
+	{
+		InitializeDefaultLODs();
+	}
+
+	OutRequest.Axiom = Axiom;
+	OutRequest.Rules = Rules;
+	OutRequest.Iterations = Iterations;
+	OutRequest.Seed = EffectiveSeed;
+	OutRequest.bPersistent = !bRandomizeSeed;
+	OutRequest.bStreamFinalIteration = bStreamFinalIteration;
+
+	OutRequest.TurtleConfig = TurtleConfig;
+	OutRequest.TurtleConfig.RandomSeed = EffectiveSeed;
+	OutRequest.TurtleConfig.LeafSize = GeometryConfig.LeafSize;
+
+	OutRequest.GeometryConfig = GeometryConfig;
+	OutRequest.LODLevels = LODLevels;
+
+	// Instanced leaves are not part of the LOD meshes
+	if (bInstancedLeaves)
+	{
+		for (FTreeLODLevel& LOD : OutRequest.LODLevels)
+		{
+			LOD.bIncludeLeaves = false;
+		}
+	}
+
+	OutRequest.ComputeKeys();
+}
+
+void UProceduralTreeComponent::ApplyGenerationOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output)
+{
+	ApplyGeneratedData(Request, PublishGenerationOutput(Request, Output), &Output);
+}
+
+FTreeGeneratedDataPtr UProceduralTreeComponent::PublishGenerationOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output) const
+{
+	TSharedRef<FTreeGeneratedData, ESPMode::ThreadSafe> Data = MakeShared<FTreeGeneratedData, ESPMode::ThreadSafe>();
+	Data->Symbols = MoveTemp(Output.Symbols);
+	Data->Skeleton = MoveTemp(Output.Skeleton);
+	Data->LODs = MoveTemp(Output.LODs);
+
+	if (bUseGenerationCache)
+	{
+		FTreeGenerationCache::Get().Add(Request.CacheKey, Data);
+
+		if (Request.bPersistent && FTreeGenerationDiskCache::IsEnabled())
+		{
+			FTreeGenerationDiskCache::StoreAsync(Request.CacheKey, Data);
+		}
+	}
+
+	return Data;
+}
+
+void UProceduralTreeComponent::ApplyGeneratedData(const FTreeGenerationRequest& Request, const FTreeGeneratedDataPtr& Data,
+                                                  const FTreeGenerationOutput* Output)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::ApplyGeneratedData);
+	const double StartTime = FPlatformTime::Seconds();
+
+	UpdatePlaceholder(false);
+
+	CachedData = Data;
+	AppliedLSystemKey = Request.LSystemKey;
+	AppliedTurtleKey = Request.TurtleKey;
+	AppliedCacheKey = Request.CacheKey;
+	AppliedSeed = Request.Seed;
+
+	bCapsuleCollision = Request.GeometryConfig.bGenerateCollision && Request.GeometryConfig.CollisionMode == ETreeCollisionMode::Capsules;
+	bTriangleCollision = Request.GeometryConfig.bGenerateCollision && Request.GeometryConfig.CollisionMode == ETreeCollisionMode::Triangles;
+
+	CurrentLODIndex = 0;
+	UpdateLeafInstances();
+	ApplyAllLODs();
+	UpdateCapsuleCollision(Request.GeometryConfig);
+	ApplyMaterials();
+	UpdateAutoLODTick();
+
+	UpdateGenerationBreakdown(Output, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	// Broadcast completion
+	OnTreeGenerated.Broadcast(true);
+}
+
+void UProceduralTreeComponent::ReleaseGenerationBreakdown()
+{
+	// Release this component's share of the memory stats
+	DEC_MEMORY_STAT_BY(STAT_LSystemTrees_SymbolMemory, LastGenerationBreakdown.SymbolBytes);
+	DEC_MEMORY_STAT_BY(STAT_LSystemTrees_SkeletonMemory, LastGenerationBreakdown.SkeletonBytes);
+	DEC_MEMORY_STAT_BY(STAT_LSystemTrees_MeshMemory, LastGenerationBreakdown.MeshBytes);
+	LastGenerationBreakdown = FTreeGenerationBreakdown();
+}
+
+void UProceduralTreeComponent::UpdateGenerationBreakdown(const FTreeGenerationOutput* Output, double ApplyTimeMs)
+{
+	// Swap this component's share of the memory stats over to the new data
+	ReleaseGenerationBreakdown();
+	FTreeGenerationBreakdown& Breakdown = LastGenerationBreakdown;
+
+	if (Output)
+	{
+		Breakdown.LSystemTimeMs = Output->LSystemTimeMs;
+		Breakdown.TurtleTimeMs = Output->TurtleTimeMs;
+		Breakdown.GeometryTimeMs = Output->GeometryTimeMs;
+	}
+	Breakdown.ApplyTimeMs = static_cast<float>(ApplyTimeMs);
+	Breakdown.TotalTimeMs = Breakdown.LSystemTimeMs + Breakdown.TurtleTimeMs + Breakdown.GeometryTimeMs + Breakdown.ApplyTimeMs;
+	Breakdown.bFromCache = Output == nullptr;
+
+	Breakdown.SymbolCount = CachedData->Symbols.Num();
+	Breakdown.SegmentCount = CachedData->Skeleton.NumSegments();
+	Breakdown.LeafCount = CachedData->Skeleton.NumLeaves();
+	Breakdown.SymbolBytes = CachedData->Symbols.GetAllocatedSize();
+	Breakdown.SkeletonBytes = CachedData->Skeleton.GetAllocatedSize();
+	Breakdown.MeshBytes = CachedData->LODs.GetAllocatedSize();
+	for (const FTreeMeshData& LOD : CachedData->LODs)
+	{
+		Breakdown.TriangleCount += LOD.GetTriangleCount();
+		Breakdown.MeshBytes += LOD.GetAllocatedSize();
+	}
+
+	INC_MEMORY_STAT_BY(STAT_LSystemTrees_SymbolMemory, Breakdown.SymbolBytes);
+	INC_MEMORY_STAT_BY(STAT_LSystemTrees_SkeletonMemory, Breakdown.SkeletonBytes);
+	INC_MEMORY_STAT_BY(STAT_LSystemTrees_MeshMemory, Breakdown.MeshBytes);
+
+	if (Breakdown.bFromCache)
+	{
+		INC_DWORD_STAT(STAT_LSystemTrees_CacheHits);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_LSystemTrees_TreesGenerated);
+	}
+
+	SET_FLOAT_STAT(STAT_LSystemTrees_LastLSystemMs, Breakdown.LSystemTimeMs);
+	SET_FLOAT_STAT(STAT_LSystemTrees_LastTurtleMs, Breakdown.TurtleTimeMs);
+	SET_FLOAT_STAT(STAT_LSystemTrees_LastGeometryMs, Breakdown.GeometryTimeMs);
+	SET_FLOAT_STAT(STAT_LSystemTrees_LastApplyMs, Breakdown.ApplyTimeMs);
+	SET_FLOAT_STAT(STAT_LSystemTrees_LastTotalMs, Breakdown.TotalTimeMs);
+
+	UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: %s"), *Breakdown.ToString());
+}
+
+void UProceduralTreeComponent::PrepareIncrementalOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output) const
+{
+	// Same skeleton inputs: only the geometry stage has to run
+	if (Request.TurtleKey == AppliedTurtleKey && CachedData->Skeleton.NumSegments() > 0)
+	{
+		Output.Symbols = CachedData->Symbols;
+		Output.Skeleton = CachedData->Skeleton;
+		Output.bHasSymbols = true;
+		Output.bInterpreted = true;
+
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Reusing turtle output, regenerating geometry only"));
+		return;
+	}
+
+	// Same L-System inputs: rerun the turtle and geometry stages (not possible if the string was streamed)
+	if (Request.LSystemKey == AppliedLSystemKey && !CachedData->Symbols.IsEmpty())
+	{
+		Output.Symbols = CachedData->Symbols;
+		Output.bHasSymbols = true;
+
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Reusing L-System symbols, reinterpreting"));
+	}
+}
+
+FTreeGeneratedDataPtr UProceduralTreeComponent::FindCachedGeneration(const FTreeGenerationRequest& Request, bool bLoadPersistent) const
+{
+	// Nothing that affects the data changed (e.g. a collision edit) - reapply what is displayed
+	if (Request.CacheKey == AppliedCacheKey && CachedData->LODs.Num() > 0)
+	{
+		return CachedData;
+	}
+
+	if (!bUseGenerationCache)
+	{
+		return FTreeGeneratedDataPtr();
+	}
+
+	if (FTreeGeneratedDataPtr Cached = FTreeGenerationCache::Get().Find(Request.CacheKey))
+	{
+		return Cached;
+	}
+
+	// Generated in an earlier session - deserializing is far cheaper than rerunning the pipeline
+	if (bLoadPersistent && Request.bPersistent && FTreeGenerationDiskCache::IsEnabled())
+	{
+		if (FTreeGeneratedDataPtr Loaded = FTreeGenerationDiskCache::Load(Request.CacheKey))
+		{
+			FTreeGenerationCache::Get().Add(Request.CacheKey, Loaded);
+			return Loaded;
+		}
+	}
+
+	return FTreeGeneratedDataPtr();
+}
+
+void UProceduralTreeComponent::FinishAsyncGeneration(const TSharedPtr<FTreeGenerationTask, ESPMode::ThreadSafe>& Task)
+{
+	// Superseded or cancelled - a newer request (or nothing) owns the component now
+	if (ActiveGeneration != Task || Task->bCancelled)
+	{
+		return;
+	}
+
+	ActiveGeneration.Reset();
+
+	// Scheduled trees are uploaded by the scheduler within its frame budget
+	UTreeGenerationSubsystem* Scheduler = Task->bScheduled ? GetGenerationScheduler() : nullptr;
+
+	if (Task->bFailed)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ProceduralTreeComponent: %s"), *Task->Output.ErrorMessage);
+		if (Scheduler)
+		{
+			// Lets trees waiting on the same inputs run their own pipeline
+			Scheduler->OnScheduledGenerationFinished(this, Task->Request, FTreeGeneratedDataPtr(), MoveTemp(Task->Output));
+		}
+		UpdatePlaceholder(false);
+		OnTreeGenerated.Broadcast(false);
+		return;
+	}
+
+	// Loaded from the persistent cache: share it in memory and display it like any cache hit
+	if (Task->PersistedData.IsValid())
+	{
+		FTreeGenerationCache::Get().Add(Task->Request.CacheKey, Task->PersistedData);
+
+		if (Scheduler)
+		{
+			Task->Output.bLoadedFromCache = true;
+			Scheduler->OnScheduledGenerationFinished(this, Task->Request, Task->PersistedData, MoveTemp(Task->Output));
+		}
+		else
+		{
+			ApplyGeneratedData(Task->Request, Task->PersistedData);
+		}
+		return;
+	}
+
+	if (Scheduler)
+	{
+		FTreeGeneratedDataPtr Data = PublishGenerationOutput(Task->Request, Task->Output);
+		Scheduler->OnScheduledGenerationFinished(this, Task->Request, Data, MoveTemp(Task->Output));
+		return;
+	}
+
+	ApplyGenerationOutput(Task->Request, Task->Output);
+}
+
+void UProceduralTreeComponent::UpdatePlaceholder(bool bShow)
+{
+	// A displayed tree (even an outdated one) is a better stand-in than the placeholder
+	bShow = bShow && PlaceholderMesh && CachedData->LODs.Num() == 0;
+
+	if (!bShow)
+	{
+		if (PlaceholderComponent)
+		{
+			PlaceholderComponent->SetVisibility(false);
+		}
+		return;
+	}
+
+	if (!PlaceholderComponent)
+	{
+		UObject* ComponentOuter = GetOwner() ? static_cast<UObject*>(GetOwner()) : static_cast<UObject*>(this);
+		PlaceholderComponent = NewObject<UStaticMeshComponent>(ComponentOuter, NAME_None, RF_Transient);
+		PlaceholderComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		PlaceholderComponent->SetupAttachment(this);
+
+		if (GetWorld())
+		{
+			PlaceholderComponent->RegisterComponent();
+		}
+	}
+
+	PlaceholderComponent->SetStaticMesh(PlaceholderMesh);
+	PlaceholderComponent->SetVisibility(true);
+}
+
+UTreeGenerationSubsystem* UProceduralTreeComponent::GetGenerationScheduler() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UTreeGenerationSubsystem>() : nullptr;
+}
+
 void UProceduralTreeComponent::InitializeGenerators()
 {
 	if (!Generator)
@@ -366,126 +1238,275 @@ void UProceduralTreeComponent::InitializeGenerators()
 	}
 }
 
-void UProceduralTreeComponent::ApplyMeshData(const FTreeMeshData& MeshData)
+void UProceduralTreeComponent::ApplyMeshData(int32 LODIndex, const FTreeMeshData& MeshData)
 {
-	// Clear existing mesh
-	ClearAllMeshSections();
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_ApplyMeshData);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::ApplyMeshData);
 
-	if (MeshData.Vertices.Num() == 0)
+	const int32 FirstSection = LODIndex * FTreeMeshData::NumSections;
+
+	if (!MeshData.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ProceduralTreeComponent: No vertices to apply"));
-		return;
+		UE_LOG(LogTemp, Warning, TEXT("ProceduralTreeComponent: No vertices to apply for LOD %d"), LODIndex);
 	}
 
-	// Convert vertex colors to color array
-	TArray<FColor> Colors;
-	Colors.Reserve(MeshData.VertexColors.Num());
-	for (const FLinearColor& LinearColor : MeshData.VertexColors)
+	// Triangle collision comes from the highest detail LOD only (hidden sections still collide)
+	const bool bCreateCollision = bTriangleCollision && LODIndex == 0;
+
+	// Sections are stored in the component's native layout and handed over as-is
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+		const int32 MeshSection = FirstSection + SectionIndex;
+
+		if (!Section.IsValid())
+		{
+			ClearMeshSection(MeshSection);
+			continue;
+		}
+
+		// Same topology and collision as what is already uploaded - only stream new vertex data
+		if (HasSectionTopology(MeshSection, Section, bCreateCollision))
+		{
+			UpdateMeshSection(MeshSection, Section.Vertices, Section.Normals, Section.UVs,
+			                  Section.VertexColors, Section.Tangents);
+
+			UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Updated mesh section %d with %d verts, %d tris"),
+			       MeshSection, Section.GetVertexCount(), Section.GetTriangleCount());
+			continue;
+		}
+
+		CreateMeshSection(MeshSection, Section.Vertices, Section.Triangles, Section.Normals,
+		                  Section.UVs, Section.VertexColors, Section.Tangents, bCreateCollision);
+
+		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Created mesh section %d with %d verts, %d tris"),
+		       MeshSection, Section.GetVertexCount(), Section.GetTriangleCount());
+	}
+}
+
+void UProceduralTreeComponent::ApplyAllLODs()
+{
+	for (int32 LODIndex = 0; LODIndex < CachedData->LODs.Num(); ++LODIndex)
 	{
-		Colors.Add(LinearColor.ToFColor(true));
+		ApplyMeshData(LODIndex, CachedData->LODs[LODIndex]);
 	}
 
-	// Create Section 0: Branches
-	// We use all vertices up to BranchVertexCount for branches
-	if (MeshData.BranchVertexCount > 0 && MeshData.BranchTriangleCount > 0)
+	// Drop sections left over from a previous tree with more LODs
+	for (int32 MeshSection = CachedData->LODs.Num() * FTreeMeshData::NumSections; MeshSection < GetNumSections(); ++MeshSection)
 	{
-		TArray<FVector> BranchVertices;
-		TArray<FVector> BranchNormals;
-		TArray<FVector2D> BranchUVs;
-		TArray<FColor> BranchColors;
-		TArray<int32> BranchTriangles;
-		TArray<FProcMeshTangent> BranchTangents;
+		ClearMeshSection(MeshSection);
+	}
+
+	UpdateLODVisibility();
+}
 
-		BranchVertices.Reserve(MeshData.BranchVertexCount);
-		BranchNormals.Reserve(MeshData.BranchVertexCount);
-		BranchUVs.Reserve(MeshData.BranchVertexCount);
-		BranchColors.Reserve(MeshData.BranchVertexCount);
-		BranchTriangles.Reserve(MeshData.BranchTriangleCount * 3);
-		BranchTangents.Reserve(MeshData.BranchVertexCount);
+void UProceduralTreeComponent::UpdateLODVisibility()
+{
+	const int32 NumMeshSections = GetNumSections();
 
-		for (int32 i = 0; i < MeshData.BranchVertexCount; ++i)
+	for (int32 LODIndex = 0; LODIndex < CachedData->LODs.Num(); ++LODIndex)
+	{
+		for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
 		{
-			BranchVertices.Add(MeshData.Vertices[i]);
-			BranchNormals.Add(MeshData.Normals[i]);
-			BranchUVs.Add(MeshData.UVs[i]);
-			BranchColors.Add(Colors[i]);
-			if (i < MeshData.Tangents.Num())
+			const int32 MeshSection = LODIndex * FTreeMeshData::NumSections + SectionIndex;
+			if (MeshSection < NumMeshSections)
 			{
-				BranchTangents.Add(FProcMeshTangent(MeshData.Tangents[i], false));
+				SetMeshSectionVisible(MeshSection, LODIndex == CurrentLODIndex);
 			}
 		}
+	}
+
+	if (LeafInstances)
+	{
+		LeafInstances->SetVisibility(bInstancedLeaves && LODLevels.IsValidIndex(CurrentLODIndex) &&
+		                             LODLevels[CurrentLODIndex].bIncludeLeaves);
+	}
+}
+
+void UProceduralTreeComponent::UpdateAutoLOD()
+{
+	UWorld* World = GetWorld();
+	if (!World || CachedData->LODs.Num() <= 1)
+	{
+		return;
+	}
+
+	// Closest view that rendered last frame (covers game and editor viewports)
+	float MinDistanceSquared = MAX_flt;
+	for (const FVector& ViewLocation : World->ViewLocationsRenderedLastFrame)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(ViewLocation, Bounds.Origin)));
+	}
+
+	if (MinDistanceSquared == MAX_flt)
+	{
+		return;
+	}
 
-		for (int32 i = 0; i < MeshData.BranchTriangleCount * 3; ++i)
+	float FOVDegrees = 90.0f;
+	if (APlayerController* PlayerController = World->GetFirstPlayerController())
+	{
+		if (PlayerController->PlayerCameraManager)
 		{
-			BranchTriangles.Add(MeshData.Triangles[i]);
+			FOVDegrees = PlayerController->PlayerCameraManager->GetFOVAngle();
 		}
+	}
 
-		CreateMeshSection_LinearColor(0, BranchVertices, BranchTriangles, BranchNormals,
-		                               BranchUVs, TArray<FLinearColor>(), BranchTangents, true);
+	const float ScreenSize = UTreeMath::ComputeScreenSize(Bounds.SphereRadius, FMath::Sqrt(MinDistanceSquared), FOVDegrees);
+	ApplyLODLevel(UTreeMath::SelectLODForScreenSize(LODLevels, ScreenSize));
+}
 
-		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Created branch mesh section with %d verts, %d tris"),
-		       BranchVertices.Num(), BranchTriangles.Num() / 3);
+void UProceduralTreeComponent::UpdateAutoLODTick()
+{
+	SetComponentTickInterval(LODUpdateInterval);
+	SetComponentTickEnabled(bAutoLOD && CachedData->LODs.Num() > 1);
+}
+
+bool UProceduralTreeComponent::HasSectionTopology(int32 SectionIndex, const FTreeMeshSectionData& Section, bool bEnableCollision)
+{
+	// UpdateMeshSection keeps the collision flag a section was created with
+	const FProcMeshSection* Existing = GetProcMeshSection(SectionIndex);
+	if (!Existing ||
+	    Existing->bEnableCollision != bEnableCollision ||
+	    Existing->ProcVertexBuffer.Num() != Section.Vertices.Num() ||
+	    Existing->ProcIndexBuffer.Num() != Section.Triangles.Num())
+	{
+		return false;
 	}
 
-	// Create Section 1: Leaves
-	const int32 LeafVertexStart = MeshData.BranchVertexCount;
-	const int32 LeafTriangleStart = MeshData.BranchTriangleCount * 3;
-	const int32 LeafVertexCount = MeshData.Vertices.Num() - LeafVertexStart;
-	const int32 LeafTriangleCount = (MeshData.Triangles.Num() - LeafTriangleStart) / 3;
+	// Index buffers hold the same values (uint32 vs int32), so compare the raw memory
+	return FMemory::Memcmp(Existing->ProcIndexBuffer.GetData(), Section.Triangles.GetData(),
+	                       Section.Triangles.Num() * sizeof(int32)) == 0;
+}
 
-	if (LeafVertexCount > 0 && LeafTriangleCount > 0)
+void UProceduralTreeComponent::ApplyMaterials()
+{
+	// Every LOD shares the same bark/leaf materials
+	const int32 NumLODs = FMath::Max(CachedData->LODs.Num(), 1);
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
 	{
-		TArray<FVector> LeafVertices;
-		TArray<FVector> LeafNormals;
-		TArray<FVector2D> LeafUVs;
-		TArray<FLinearColor> LeafColors;
-		TArray<int32> LeafTriangles;
-		TArray<FProcMeshTangent> LeafTangents;
+		const int32 FirstSection = LODIndex * FTreeMeshData::NumSections;
 
-		LeafVertices.Reserve(LeafVertexCount);
-		LeafNormals.Reserve(LeafVertexCount);
-		LeafUVs.Reserve(LeafVertexCount);
-		LeafColors.Reserve(LeafVertexCount);
-		LeafTriangles.Reserve(LeafTriangleCount * 3);
-		LeafTangents.Reserve(LeafVertexCount);
+		if (BarkMaterial)
+		{
+			SetMaterial(FirstSection + FTreeMeshData::BranchSectionIndex, BarkMaterial);
+		}
 
-		for (int32 i = LeafVertexStart; i < MeshData.Vertices.Num(); ++i)
+		if (LeafMaterial)
 		{
-			LeafVertices.Add(MeshData.Vertices[i]);
-			LeafNormals.Add(MeshData.Normals[i]);
-			LeafUVs.Add(MeshData.UVs[i]);
-			LeafColors.Add(MeshData.VertexColors[i]);
-			if (i < MeshData.Tangents.Num())
-			{
-				LeafTangents.Add(FProcMeshTangent(MeshData.Tangents[i], false));
-			}
+			SetMaterial(FirstSection + FTreeMeshData::LeafSectionIndex, LeafMaterial);
 		}
+	}
 
-		// Remap triangle indices to local leaf vertex indices
-		for (int32 i = LeafTriangleStart; i < MeshData.Triangles.Num(); ++i)
+	if (LeafInstances && LeafMaterial)
+	{
+		LeafInstances->SetMaterial(0, LeafMaterial);
+	}
+}
+
+void UProceduralTreeComponent::UpdateLeafInstances()
+{
+	const FTreeSkeleton& Skeleton = CachedData->Skeleton;
+	if (!bInstancedLeaves || Skeleton.NumLeaves() == 0)
+	{
+		if (LeafInstances)
+		{
+			LeafInstances->ClearInstances();
+		}
+		return;
+	}
+
+	UStaticMesh* CardMesh = GetLeafCardMesh();
+	if (!CardMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProceduralTreeComponent: No leaf card mesh available for instanced leaves"));
+		if (LeafInstances)
 		{
-			LeafTriangles.Add(MeshData.Triangles[i] - LeafVertexStart);
+			LeafInstances->ClearInstances();
 		}
+		return;
+	}
+
+	if (!LeafInstances)
+	{
+		UObject* ComponentOuter = GetOwner() ? static_cast<UObject*>(GetOwner()) : static_cast<UObject*>(this);
+		LeafInstances = NewObject<UHierarchicalInstancedStaticMeshComponent>(ComponentOuter, NAME_None, RF_Transient);
+		LeafInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		LeafInstances->SetupAttachment(this);
+	}
+
+	// Components built before the tree had a world register on the next update
+	if (!LeafInstances->IsRegistered() && GetWorld())
+	{
+		LeafInstances->RegisterComponent();
+	}
 
-		CreateMeshSection_LinearColor(1, LeafVertices, LeafTriangles, LeafNormals,
-		                               LeafUVs, LeafColors, LeafTangents, true);
+	InitializeGenerators();
+
+	// Every tree instances the same card, scaled per leaf from the card's own size
+	const FVector CardSize = CardMesh->GetBoundingBox().GetSize();
+	TArray<FTransform> Transforms;
+	GeometryBuilder->BuildLeafInstanceTransforms(Skeleton, FVector2D(CardSize.X, CardSize.Y), Transforms);
+
+	LeafInstances->SetStaticMesh(CardMesh);
+	// Fade over the last part of the range (needs PerInstanceFadeAmount in the material)
+	const int32 CullEnd = FMath::RoundToInt(LeafCullDistance);
+	const int32 CullStart = FMath::RoundToInt(LeafCullDistance * (1.0f - LeafCullFadeFraction));
+	LeafInstances->SetCullDistances(CullStart, CullEnd);
+	LeafInstances->ClearInstances();
+	LeafInstances->AddInstances(Transforms, false);
+
+	UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: %d leaf instances"), Transforms.Num());
+}
+
+UStaticMesh* UProceduralTreeComponent::GetLeafCardMesh() const
+{
+	if (LeafCardMesh)
+	{
+		return LeafCardMesh;
+	}
 
-		UE_LOG(LogTemp, Verbose, TEXT("ProceduralTreeComponent: Created leaf mesh section with %d verts, %d tris"),
-		       LeafVertices.Num(), LeafTriangles.Num() / 3);
+	static TWeakObjectPtr<UStaticMesh> DefaultCard;
+	if (!DefaultCard.IsValid())
+	{
+		DefaultCard = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
 	}
+	return DefaultCard.Get();
 }
 
-void UProceduralTreeComponent::ApplyMaterials()
+void UProceduralTreeComponent::UpdateCapsuleCollision(const FTreeGeometryConfig& Config)
 {
-	// Apply bark material to section 0
-	if (BarkMaterial)
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_UpdateCollision);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProceduralTree::UpdateCapsuleCollision);
+
+	if (!bCapsuleCollision)
 	{
-		SetMaterial(0, BarkMaterial);
+		// The mesh sections own collision again; drop the capsules so they are not kept alive
+		if (CapsuleBodySetup)
+		{
+			CapsuleBodySetup->AggGeom.EmptyElements();
+			CapsuleBodySetup->InvalidatePhysicsData();
+			RecreatePhysicsState();
+		}
+		return;
 	}
 
-	// Apply leaf material to section 1
-	if (LeafMaterial)
+	if (!CapsuleBodySetup)
 	{
-		SetMaterial(1, LeafMaterial);
+		CapsuleBodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+		CapsuleBodySetup->BodySetupGuid = FGuid::NewGuid();
+		CapsuleBodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+		CapsuleBodySetup->bGenerateMirroredCollision = false;
 	}
+
+	// Capsules need no cooking, so rebuilding them costs O(segments) regardless of triangle count
+	CapsuleBodySetup->InvalidatePhysicsData();
+	CapsuleBodySetup->AggGeom.EmptyElements();
+	UTreeGeometry::BuildCollisionCapsules(CachedData->Skeleton, Config.CollisionMaxDepth, Config.CollisionMinRadius,
+	                                      Config.MaxCollisionCapsules, CapsuleBodySetup->AggGeom.SphylElems);
+	CapsuleBodySetup->CreatePhysicsMeshes();
+
+	RecreatePhysicsState();
+
+	UE_LOG(LogTemp, Log, TEXT("ProceduralTreeComponent: Built %d collision capsules"), CapsuleBodySetup->AggGeom.SphylElems.Num());
 }
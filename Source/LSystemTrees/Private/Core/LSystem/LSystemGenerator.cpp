@@ -4,77 +4,41 @@
 
 #include "Core/LSystem/LSystemGenerator.h"
 #include "Async/Async.h"
-#include "HAL/RunnableThread.h"
+#include "Async/ParallelFor.h"
+#include "Core/Utilities/TreeScratch.h"
+#include "Core/Utilities/TreeStats.h"
 
 DEFINE_LOG_CATEGORY(LogLSystem);
 
-// ============================================================================
-// FLSystemAsyncTask - Async generation task
-// ============================================================================
+/** Input symbols rewritten per block when streaming the final iteration */
+static constexpr int32 LSystemStreamBlockSize = 4096;
 
-class FLSystemAsyncTask : public FRunnable
+namespace
 {
-public:
-	FLSystemAsyncTask(ULSystemGenerator* InGenerator, int32 InIterations)
-		: Generator(InGenerator)
-		, Iterations(InIterations)
-		, bStopping(false)
-	{
-	}
-
-	virtual ~FLSystemAsyncTask()
-	{
-	}
-
-	virtual bool Init() override
+	/** Per-chunk output of parallel rewriting, pooled as a whole so every chunk keeps its allocation */
+	struct FLSystemChunkBuffers
 	{
-		return true;
-	}
+		TArray<FLSystemSymbolBuffer> Chunks;
 
-	virtual uint32 Run() override
-	{
-		if (!Generator.IsValid())
+		void Reset()
 		{
-			return 1;
+			for (FLSystemSymbolBuffer& Chunk : Chunks)
+			{
+				Chunk.Reset();
+			}
 		}
 
-		// Perform generation
-		FLSystemGenerationResult Result = Generator->DoGeneration(Iterations, true);
-
-		// Notify completion on game thread
-		if (Generator.IsValid())
+		SIZE_T GetAllocatedSize() const
 		{
-			AsyncTask(ENamedThreads::GameThread, [this, Result]()
+			SIZE_T Size = Chunks.GetAllocatedSize();
+			for (const FLSystemSymbolBuffer& Chunk : Chunks)
 			{
-				if (Generator.IsValid())
-				{
-					Generator->HandleAsyncComplete(Result);
-				}
-			});
+				Size += Chunk.GetAllocatedSize();
+			}
+			return Size;
 		}
-
-		return 0;
-	}
-
-	virtual void Stop() override
-	{
-		bStopping = true;
-	}
-
-	virtual void Exit() override
-	{
-	}
-
-	bool IsStopping() const
-	{
-		return bStopping;
-	}
-
-private:
-	TWeakObjectPtr<ULSystemGenerator> Generator;
-	int32 Iterations;
-	TAtomic<bool> bStopping;
-};
+	};
+}
 
 // ============================================================================
 // Constructor / Destructor
@@ -82,31 +46,22 @@ private:
 
 ULSystemGenerator::ULSystemGenerator()
 	: bLookupDirty(true)
+	, bCanContinueGeneration(false)
 	, bCancelRequested(false)
-	, CurrentAsyncTask(nullptr)
-	, CurrentAsyncThread(nullptr)
 {
 	Config = FLSystemConfig();
 	RandomStream.Initialize(FMath::Rand());
+	RuleTable.Reset();
 }
 
 ULSystemGenerator::~ULSystemGenerator()
 {
-	// Cancel any running async task
+	// Cancel any running async task and wait for it to finish
 	CancelAsyncGeneration();
 
-	// Wait for thread to finish
-	if (CurrentAsyncThread)
-	{
-		CurrentAsyncThread->WaitForCompletion();
-		delete CurrentAsyncThread;
-		CurrentAsyncThread = nullptr;
-	}
-
-	if (CurrentAsyncTask)
+	if (CurrentAsyncTask.IsValid())
 	{
-		delete CurrentAsyncTask;
-		CurrentAsyncTask = nullptr;
+		CurrentAsyncTask.Wait();
 	}
 }
 
@@ -121,6 +76,7 @@ void ULSystemGenerator::Initialize(const FString& Axiom)
 	CurrentAxiom = Axiom;
 	State.Initialize(Axiom);
 	Statistics.Reset();
+	bCanContinueGeneration = false;
 
 	UE_LOG(LogLSystem, Verbose, TEXT("Initialized with axiom: %s"), *Axiom);
 }
@@ -135,7 +91,9 @@ void ULSystemGenerator::Reset()
 	Statistics.Reset();
 	RuleLookup.Empty();
 	ProbabilityTotals.Empty();
+	RuleTable.Reset();
 	bLookupDirty = true;
+	bCanContinueGeneration = false;
 }
 
 // ============================================================================
@@ -217,6 +175,7 @@ void ULSystemGenerator::ClearRules()
 	Rules.Empty();
 	RuleLookup.Empty();
 	ProbabilityTotals.Empty();
+	RuleTable.Reset();
 	bLookupDirty = true;
 
 	UE_LOG(LogLSystem, Verbose, TEXT("Cleared all rules"));
@@ -250,28 +209,171 @@ bool ULSystemGenerator::HasRuleForSymbol(const FString& Symbol) const
 
 FLSystemGenerationResult ULSystemGenerator::Generate(int32 Iterations)
 {
-	return DoGeneration(Iterations, false);
+	FLSystemGenerationResult Result = DoGeneration(Iterations, false);
+	Result.MaterializeStrings();
+	return Result;
 }
 
 FString ULSystemGenerator::GenerateString(int32 Iterations)
 {
-	FLSystemGenerationResult Result = Generate(Iterations);
+	FLSystemGenerationResult Result = GenerateSymbols(Iterations);
 	if (Result.bSuccess)
 	{
-		return Result.GeneratedString;
+		return Result.Symbols.ToString();
 	}
 
 	UE_LOG(LogLSystem, Warning, TEXT("Generation failed: %s"), *Result.ErrorMessage);
 	return FString();
 }
 
+FLSystemGenerationResult ULSystemGenerator::GenerateSymbols(int32 Iterations)
+{
+	return DoGeneration(Iterations, false);
+}
+
+FLSystemGenerationResult ULSystemGenerator::GenerateStreamed(int32 Iterations, FLSystemSymbolSink Sink)
+{
+	return DoGeneration(Iterations, false, &Sink);
+}
+
+// ============================================================================
+// Incremental Generation
+// ============================================================================
+
+FLSystemGenerationResult ULSystemGenerator::GrowOneIteration()
+{
+	FLSystemGenerationResult Result = GrowOneIterationSymbols();
+	Result.MaterializeStrings();
+	return Result;
+}
+
+FLSystemGenerationResult ULSystemGenerator::GrowOneIterationSymbols()
+{
+	if (IsGenerating())
+	{
+		return FLSystemGenerationResult::Failure(TEXT("Async generation in progress"));
+	}
+
+	FString ValidationError;
+	if (!Validate(ValidationError))
+	{
+		return FLSystemGenerationResult::Failure(ValidationError);
+	}
+
+	if (bLookupDirty)
+	{
+		BuildRuleLookup();
+	}
+
+	// Nothing to continue: start from the axiom exactly like DoGeneration
+	if (!bCanContinueGeneration)
+	{
+		if (Config.RandomSeed != 0)
+		{
+			RandomStream.Initialize(Config.RandomSeed);
+		}
+		else
+		{
+			RandomStream.Initialize(FMath::Rand());
+		}
+
+		FScopeLock Lock(&StateLock);
+		State.CurrentSymbols.SetFromString(CurrentAxiom);
+		State.CurrentIteration = 0;
+		State.SymbolHistory.Reset();
+		Statistics.Reset();
+
+		if (Config.bStoreHistory)
+		{
+			State.SymbolHistory = MakeShared<FLSystemSymbolHistory, ESPMode::ThreadSafe>();
+			State.SymbolHistory->Add(State.CurrentSymbols);
+		}
+
+		bCanContinueGeneration = true;
+	}
+
+	const int32 Iteration = State.CurrentIteration;
+
+	FString TerminationReason;
+	if (CheckTermination(State.CurrentSymbols, Iteration, TerminationReason))
+	{
+		return FLSystemGenerationResult::Failure(TerminationReason);
+	}
+
+	// Timing accumulates over the steps
+	const double StartTime = FPlatformTime::Seconds() - Statistics.GenerationTimeMs / 1000.0;
+
+	// Only the calling thread writes State.CurrentSymbols, so reading it without the lock is safe
+	if (!ApplyRules(State.CurrentSymbols, GrowthBuffer))
+	{
+		return FLSystemGenerationResult::Failure(FString::Printf(
+			TEXT("Iteration %d would exceed maximum string length (%d)"), Iteration + 1, Config.MaxStringLength));
+	}
+
+	{
+		FScopeLock Lock(&StateLock);
+
+		// The previous string stays in GrowthBuffer as scratch space for the next step
+		Swap(State.CurrentSymbols, GrowthBuffer);
+		State.CurrentIteration = Iteration + 1;
+		State.ProgressPercent = 1.0f;
+
+		if (State.SymbolHistory.IsValid())
+		{
+			// Results handed out earlier keep their history immutable: extend a copy if the arena is shared
+			if (!State.SymbolHistory.IsUnique())
+			{
+				State.SymbolHistory = MakeShared<FLSystemSymbolHistory, ESPMode::ThreadSafe>(*State.SymbolHistory);
+			}
+			State.SymbolHistory->Add(State.CurrentSymbols);
+		}
+	}
+
+	LogIteration(Iteration + 1, State.CurrentSymbols);
+
+	FLSystemSymbolCounts Counts;
+	Counts.Accumulate(State.CurrentSymbols);
+	UpdateStatistics(State.CurrentSymbols.Num(), Counts, Iteration + 1, StartTime);
+
+	if (OnIterationComplete.IsBound())
+	{
+		OnIterationComplete.Broadcast(Iteration + 1, State.CurrentSymbols.ToString());
+	}
+
+	FLSystemStatistics FinalStats;
+	FLSystemSymbolBuffer Symbols;
+	FLSystemSymbolHistoryPtr History;
+	{
+		FScopeLock Lock(&StateLock);
+		FinalStats = Statistics;
+		Symbols = State.CurrentSymbols;
+		History = State.SymbolHistory;
+	}
+
+	return FLSystemGenerationResult::Success(MoveTemp(Symbols), MoveTemp(History), FinalStats);
+}
+
 FString ULSystemGenerator::PerformSingleIteration(const FString& InputString)
 {
 	if (bLookupDirty)
 	{
 		BuildRuleLookup();
 	}
-	return ApplyRules(InputString);
+
+	FLSystemSymbolBuffer Input;
+	if (!Input.SetFromString(InputString))
+	{
+		UE_LOG(LogLSystem, Warning, TEXT("PerformSingleIteration: non-ASCII symbols in input were dropped"));
+	}
+
+	FLSystemSymbolBuffer Output;
+	if (!ApplyRules(Input, Output))
+	{
+		UE_LOG(LogLSystem, Warning, TEXT("PerformSingleIteration: result would exceed maximum string length (%d)"),
+		       Config.MaxStringLength);
+		return InputString;
+	}
+	return Output.ToString();
 }
 
 // ============================================================================
@@ -306,22 +408,33 @@ void ULSystemGenerator::GenerateAsync(int32 Iterations)
 
 	bCancelRequested = false;
 
-	// Clean up previous task if any
-	if (CurrentAsyncThread)
+	// The previous task has already left DoGeneration; wait for its tail to finish
+	if (CurrentAsyncTask.IsValid())
 	{
-		CurrentAsyncThread->WaitForCompletion();
-		delete CurrentAsyncThread;
-		CurrentAsyncThread = nullptr;
+		CurrentAsyncTask.Wait();
 	}
-	if (CurrentAsyncTask)
+
+	// Run on a task graph worker instead of a dedicated thread per generator
+	TWeakObjectPtr<ULSystemGenerator> WeakThis(this);
+	CurrentAsyncTask = UE::Tasks::Launch(TEXT("LSystemGenerator"), [WeakThis, Iterations]()
 	{
-		delete CurrentAsyncTask;
-		CurrentAsyncTask = nullptr;
-	}
+		ULSystemGenerator* This = WeakThis.Get();
+		if (!This)
+		{
+			return;
+		}
 
-	// Create and start new task
-	CurrentAsyncTask = new FLSystemAsyncTask(this, Iterations);
-	CurrentAsyncThread = FRunnableThread::Create(CurrentAsyncTask, TEXT("LSystemGenerator"));
+		FLSystemGenerationResult Result = This->DoGeneration(Iterations, true);
+
+		// Notify completion on game thread (the result is moved, not copied, into the handoff)
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Result = MoveTemp(Result)]() mutable
+		{
+			if (ULSystemGenerator* Generator = WeakThis.Get())
+			{
+				Generator->HandleAsyncComplete(MoveTemp(Result));
+			}
+		});
+	});
 
 	UE_LOG(LogLSystem, Log, TEXT("Started async generation with %d iterations"), Iterations);
 }
@@ -332,11 +445,6 @@ void ULSystemGenerator::CancelAsyncGeneration()
 	{
 		bCancelRequested = true;
 
-		if (CurrentAsyncTask)
-		{
-			CurrentAsyncTask->Stop();
-		}
-
 		UE_LOG(LogLSystem, Log, TEXT("Async generation cancelled"));
 	}
 }
@@ -354,7 +462,15 @@ bool ULSystemGenerator::IsGenerating() const
 FLSystemState ULSystemGenerator::GetCurrentState() const
 {
 	FScopeLock Lock(&StateLock);
-	return State;
+
+	// Convert the native symbol buffers for Blueprint
+	FLSystemState OutState = State;
+	OutState.CurrentString = State.CurrentSymbols.ToString();
+	if (State.SymbolHistory.IsValid())
+	{
+		State.SymbolHistory->ToStrings(OutState.History);
+	}
+	return OutState;
 }
 
 FLSystemStatistics ULSystemGenerator::GetStatistics() const
@@ -383,6 +499,14 @@ bool ULSystemGenerator::Validate(FString& OutError) const
 		return false;
 	}
 
+	// Symbols are stored as single bytes, so only ASCII is supported
+	const int32 InvalidAxiomIndex = FLSystemSymbolBuffer::FindInvalidSymbol(CurrentAxiom);
+	if (InvalidAxiomIndex != INDEX_NONE)
+	{
+		OutError = FString::Printf(TEXT("Axiom contains non-ASCII symbol at index %d"), InvalidAxiomIndex);
+		return false;
+	}
+
 	// Validate each rule
 	for (int32 i = 0; i < Rules.Num(); ++i)
 	{
@@ -392,6 +516,16 @@ bool ULSystemGenerator::Validate(FString& OutError) const
 			OutError = FString::Printf(TEXT("Invalid rule at index %d: %s"), i, *RuleError);
 			return false;
 		}
+
+		const FLSystemRule& Rule = Rules[i];
+		if (FLSystemSymbolBuffer::FindInvalidSymbol(Rule.Predecessor) != INDEX_NONE ||
+		    FLSystemSymbolBuffer::FindInvalidSymbol(Rule.Successor) != INDEX_NONE ||
+		    FLSystemSymbolBuffer::FindInvalidSymbol(Rule.LeftContext) != INDEX_NONE ||
+		    FLSystemSymbolBuffer::FindInvalidSymbol(Rule.RightContext) != INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Invalid rule at index %d: contains non-ASCII symbols"), i);
+			return false;
+		}
 	}
 
 	OutError.Empty();
@@ -405,6 +539,7 @@ bool ULSystemGenerator::Validate(FString& OutError) const
 void ULSystemGenerator::SetRandomSeed(int32 Seed)
 {
 	Config.RandomSeed = Seed;
+	bCanContinueGeneration = false;
 	if (Seed != 0)
 	{
 		RandomStream.Initialize(Seed);
@@ -422,25 +557,96 @@ int32 ULSystemGenerator::EstimateStringLength(int32 Iterations) const
 		return 0;
 	}
 
-	// Calculate average growth factor
-	float TotalGrowth = 0.0f;
-	float TotalWeight = 0.0f;
+	// Growth matrix: expected number of each symbol produced per input symbol.
+	// Rules of a symbol are weighted by probability (context is ignored), symbols without rules map to themselves.
+	constexpr int32 NumSymbols = FLSystemRuleTable::NumSymbols;
 
+	TArray<double> TotalWeight;
+	TotalWeight.SetNumZeroed(NumSymbols);
 	for (const FLSystemRule& Rule : Rules)
 	{
-		float Growth = static_cast<float>(Rule.Successor.Len());
-		float Weight = Rule.Probability;
-		TotalGrowth += Growth * Weight;
-		TotalWeight += Weight;
+		const TCHAR Predecessor = Rule.GetPredecessorChar();
+		if (FLSystemSymbolBuffer::IsValidSymbol(Predecessor))
+		{
+			TotalWeight[Predecessor] += FMath::Max(Rule.Probability, 0.0f);
+		}
+	}
+
+	TArray<double> Growth;
+	Growth.SetNumZeroed(NumSymbols * NumSymbols);
+	TArray<bool> HasRules;
+	HasRules.SetNumZeroed(NumSymbols);
+
+	for (const FLSystemRule& Rule : Rules)
+	{
+		const TCHAR Predecessor = Rule.GetPredecessorChar();
+		if (!FLSystemSymbolBuffer::IsValidSymbol(Predecessor))
+		{
+			continue;
+		}
+
+		HasRules[Predecessor] = true;
+		const double Weight = TotalWeight[Predecessor] > 0.0 ? FMath::Max(Rule.Probability, 0.0f) / TotalWeight[Predecessor] : 1.0;
+
+		for (const TCHAR SuccessorChar : Rule.Successor)
+		{
+			if (FLSystemSymbolBuffer::IsValidSymbol(SuccessorChar))
+			{
+				Growth[Predecessor * NumSymbols + SuccessorChar] += Weight;
+			}
+		}
+	}
+
+	for (int32 Symbol = 0; Symbol < NumSymbols; ++Symbol)
+	{
+		if (!HasRules[Symbol])
+		{
+			Growth[Symbol * NumSymbols + Symbol] = 1.0;
+		}
+	}
+
+	// Propagate the axiom's symbol counts through the growth matrix
+	TArray<double> Counts;
+	Counts.SetNumZeroed(NumSymbols);
+	for (const TCHAR AxiomChar : CurrentAxiom)
+	{
+		if (FLSystemSymbolBuffer::IsValidSymbol(AxiomChar))
+		{
+			Counts[AxiomChar] += 1.0;
+		}
 	}
 
-	float AverageGrowth = TotalWeight > 0.0f ? TotalGrowth / TotalWeight : 1.0f;
+	TArray<double> NextCounts;
+	NextCounts.SetNumZeroed(NumSymbols);
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		FMemory::Memzero(NextCounts.GetData(), NumSymbols * sizeof(double));
+
+		for (int32 From = 0; From < NumSymbols; ++From)
+		{
+			if (Counts[From] <= 0.0)
+			{
+				continue;
+			}
+
+			const double* Row = Growth.GetData() + From * NumSymbols;
+			for (int32 To = 0; To < NumSymbols; ++To)
+			{
+				NextCounts[To] += Counts[From] * Row[To];
+			}
+		}
+
+		Swap(Counts, NextCounts);
+	}
 
-	// Estimate: axiom_length * growth^iterations
-	float Estimate = static_cast<float>(CurrentAxiom.Len()) *
-	                 FMath::Pow(FMath::Max(AverageGrowth, 1.0f), static_cast<float>(Iterations));
+	double Estimate = 0.0;
+	for (const double Count : Counts)
+	{
+		Estimate += Count;
+	}
 
-	return FMath::TruncToInt(FMath::Min(Estimate, static_cast<float>(MAX_int32)));
+	return static_cast<int32>(FMath::Min(Estimate, static_cast<double>(MAX_int32)));
 }
 
 TMap<FString, int32> ULSystemGenerator::CountSymbols(const FString& InputString)
@@ -461,52 +667,270 @@ TMap<FString, int32> ULSystemGenerator::CountSymbols(const FString& InputString)
 // Internal Methods
 // ============================================================================
 
-FString ULSystemGenerator::ApplyRules(const FString& InputString)
+bool ULSystemGenerator::ApplyRules(const FLSystemSymbolBuffer& Input, FLSystemSymbolBuffer& Output)
 {
-	const int32 InputLength = InputString.Len();
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_ApplyRules);
+	TRACE_CPUPROFILER_EVENT_SCOPE(LSystem::ApplyRules);
+
+	const int32 InputLength = Input.Num();
 
-	// Pre-allocate result string with estimated capacity
-	int32 EstimatedCapacity = InputLength * 2;
-	FString Result;
-	Result.Reserve(EstimatedCapacity);
+	if (Config.bParallelRewrite && InputLength >= FMath::Max(Config.ParallelMinLength, 2 * Config.ParallelChunkSize))
+	{
+		return ApplyRulesParallel(Input, Output);
+	}
+
+	// Size the output once from the length prediction
+	int64 MinLength = 0;
+	int64 MaxLength = 0;
+	PredictOutputLength(Input, 0, InputLength, MinLength, MaxLength);
+
+	if (MinLength > Config.MaxStringLength)
+	{
+		Output.Reset();
+		return false;
+	}
+
+	const bool bMayExceedLimit = MaxLength > Config.MaxStringLength;
+	Output.Reset(static_cast<int32>(FMath::Min<int64>(MaxLength, Config.MaxStringLength + 1)));
 
 	int32 RulesAppliedThisIteration = 0;
 	int32 ContextRulesAppliedThisIteration = 0;
 
-	// Process each character
-	for (int32 i = 0; i < InputLength; ++i)
+	if (!bMayExceedLimit)
+	{
+		RewriteRange<false>(Input, 0, InputLength, RandomStream, Output, Config.MaxStringLength,
+		                    RulesAppliedThisIteration, ContextRulesAppliedThisIteration);
+	}
+	else if (!RewriteRange<true>(Input, 0, InputLength, RandomStream, Output, Config.MaxStringLength,
+	                             RulesAppliedThisIteration, ContextRulesAppliedThisIteration))
+	{
+		// Only reachable for stochastic/context rules whose predicted range straddles the limit
+		UE_LOG(LogLSystem, Warning, TEXT("String length exceeded maximum during iteration. Truncating."));
+		Output.Truncate(Config.MaxStringLength);
+	}
+
+	// Update statistics
 	{
-		TCHAR CurrentChar = InputString[i];
+		FScopeLock Lock(&StateLock);
+		Statistics.RulesApplied += RulesAppliedThisIteration;
+		Statistics.ContextRulesApplied += ContextRulesAppliedThisIteration;
+	}
 
-		// Get context characters
-		TCHAR LeftContext = (i > 0) ? InputString[i - 1] : TEXT('\0');
-		TCHAR RightContext = (i < InputLength - 1) ? InputString[i + 1] : TEXT('\0');
+	return true;
+}
 
-		// Try to find a matching rule
-		const FLSystemRule* SelectedRule = SelectRule(CurrentChar, LeftContext, RightContext);
+bool ULSystemGenerator::ApplyRulesParallel(const FLSystemSymbolBuffer& Input, FLSystemSymbolBuffer& Output)
+{
+	const int32 InputLength = Input.Num();
+	const int32 ChunkSize = FMath::Max(Config.ParallelChunkSize, 1024);
+	const int32 NumChunks = FMath::DivideAndRoundUp(InputLength, ChunkSize);
+	const int32 StringLimit = Config.MaxStringLength;
+
+	auto GetChunkRange = [InputLength, ChunkSize](int32 ChunkIndex, int32& OutStart, int32& OutEnd)
+	{
+		OutStart = ChunkIndex * ChunkSize;
+		OutEnd = FMath::Min(OutStart + ChunkSize, InputLength);
+	};
+
+	// Pass 0: predict each chunk's output length
+	TArray<int64> ChunkMinLengths;
+	TArray<int64> ChunkMaxLengths;
+	ChunkMinLengths.SetNumUninitialized(NumChunks);
+	ChunkMaxLengths.SetNumUninitialized(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		int32 Start, End;
+		GetChunkRange(ChunkIndex, Start, End);
+		PredictOutputLength(Input, Start, End, ChunkMinLengths[ChunkIndex], ChunkMaxLengths[ChunkIndex]);
+	});
+
+	int64 TotalMinLength = 0;
+	int64 TotalMaxLength = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		TotalMinLength += ChunkMinLengths[ChunkIndex];
+		TotalMaxLength += ChunkMaxLengths[ChunkIndex];
+	}
+
+	if (TotalMinLength > StringLimit)
+	{
+		Output.Reset();
+		return false;
+	}
 
-		if (SelectedRule)
+	const bool bMayExceedLimit = TotalMaxLength > StringLimit;
+
+	// One draw per iteration from the main stream; chunk streams are derived from it by index
+	const uint32 IterationSeed = RandomStream.GetUnsignedInt();
+
+	// Only grown, never shrunk: chunks beyond NumChunks keep their allocations for longer inputs
+	TTreeScratch<FLSystemChunkBuffers> ChunkScratch;
+	TArray<FLSystemSymbolBuffer>& ChunkBuffers = ChunkScratch->Chunks;
+	if (ChunkBuffers.Num() < NumChunks)
+	{
+		ChunkBuffers.SetNum(NumChunks);
+	}
+
+	TArray<int32> ChunkRulesApplied;
+	TArray<int32> ChunkContextRulesApplied;
+	ChunkRulesApplied.SetNumZeroed(NumChunks);
+	ChunkContextRulesApplied.SetNumZeroed(NumChunks);
+
+	// Pass 1: rewrite each chunk into its own, exactly sized buffer
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		int32 Start, End;
+		GetChunkRange(ChunkIndex, Start, End);
+
+		FRandomStream ChunkStream(static_cast<int32>(HashCombine(IterationSeed, GetTypeHash(ChunkIndex))));
+
+		FLSystemSymbolBuffer& ChunkOutput = ChunkBuffers[ChunkIndex];
+		ChunkOutput.Reset(static_cast<int32>(FMath::Min<int64>(ChunkMaxLengths[ChunkIndex], StringLimit + 1)));
+
+		// A single chunk beyond the limit means the whole output is; it gets truncated below
+		if (bMayExceedLimit)
 		{
-			// Apply the rule
-			Result.Append(SelectedRule->Successor);
-			RulesAppliedThisIteration++;
+			RewriteRange<true>(Input, Start, End, ChunkStream, ChunkOutput, StringLimit,
+			                   ChunkRulesApplied[ChunkIndex], ChunkContextRulesApplied[ChunkIndex]);
+		}
+		else
+		{
+			RewriteRange<false>(Input, Start, End, ChunkStream, ChunkOutput, StringLimit,
+			                    ChunkRulesApplied[ChunkIndex], ChunkContextRulesApplied[ChunkIndex]);
+		}
+	});
 
-			if (SelectedRule->IsContextSensitive())
-			{
-				ContextRulesAppliedThisIteration++;
-			}
+	// Prefix sums give each chunk its offset in the final output
+	TArray<int32> ChunkOffsets;
+	ChunkOffsets.SetNumUninitialized(NumChunks);
+
+	int64 TotalLength = 0;
+	int32 RulesAppliedThisIteration = 0;
+	int32 ContextRulesAppliedThisIteration = 0;
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		ChunkOffsets[ChunkIndex] = static_cast<int32>(FMath::Min<int64>(TotalLength, StringLimit));
+		TotalLength += ChunkBuffers[ChunkIndex].Num();
+		RulesAppliedThisIteration += ChunkRulesApplied[ChunkIndex];
+		ContextRulesAppliedThisIteration += ChunkContextRulesApplied[ChunkIndex];
+	}
+
+	if (TotalLength > StringLimit)
+	{
+		UE_LOG(LogLSystem, Warning, TEXT("String length exceeded maximum during iteration. Truncating."));
+	}
+
+	const int32 OutputLength = static_cast<int32>(FMath::Min<int64>(TotalLength, StringLimit));
+
+	// Pass 2: copy chunks into the preallocated output (chunks past the limit are clipped)
+	Output.Reset(OutputLength);
+	Output.Data.SetNumUninitialized(OutputLength);
+
+	uint8* OutputData = Output.GetData();
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Offset = ChunkOffsets[ChunkIndex];
+		const int32 Count = FMath::Min(ChunkBuffers[ChunkIndex].Num(), OutputLength - Offset);
+		if (Count > 0)
+		{
+			FMemory::Memcpy(OutputData + Offset, ChunkBuffers[ChunkIndex].GetData(), Count);
+		}
+	});
+
+	// Update statistics
+	{
+		FScopeLock Lock(&StateLock);
+		Statistics.RulesApplied += RulesAppliedThisIteration;
+		Statistics.ContextRulesApplied += ContextRulesAppliedThisIteration;
+	}
+
+	UE_LOG(LogLSystem, Verbose, TEXT("Parallel rewrite: %d symbols in %d chunks -> %d symbols"),
+	       InputLength, NumChunks, OutputLength);
+
+	return true;
+}
+
+void ULSystemGenerator::PredictOutputLength(const FLSystemSymbolBuffer& Input, int32 Start, int32 End,
+                                            int64& OutMinLength, int64& OutMaxLength) const
+{
+	// Histogram of the range, then weight by the per-symbol output lengths of the rule table
+	int32 Histogram[FLSystemRuleTable::NumSymbols] = { 0 };
+	Input.AccumulateHistogram(Histogram, Start, End);
+
+	OutMinLength = 0;
+	OutMaxLength = 0;
+
+	for (int32 Symbol = 0; Symbol < FLSystemRuleTable::NumSymbols; ++Symbol)
+	{
+		if (Histogram[Symbol] > 0)
+		{
+			const FLSystemSymbolEntry& Entry = RuleTable.Entries[Symbol];
+			OutMinLength += static_cast<int64>(Histogram[Symbol]) * Entry.MinOutputLength;
+			OutMaxLength += static_cast<int64>(Histogram[Symbol]) * Entry.MaxOutputLength;
+		}
+	}
+}
+
+bool ULSystemGenerator::StreamRules(const FLSystemSymbolBuffer& Input, FLSystemSymbolSink Sink,
+                                    FLSystemSymbolCounts& OutCounts, int32& OutLength)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_ApplyRules);
+	TRACE_CPUPROFILER_EVENT_SCOPE(LSystem::StreamRules);
+
+	const int32 InputLength = Input.Num();
+	OutLength = 0;
+
+	int64 MinLength = 0;
+	int64 MaxLength = 0;
+	PredictOutputLength(Input, 0, InputLength, MinLength, MaxLength);
+
+	if (MinLength > Config.MaxStringLength)
+	{
+		return false;
+	}
+
+	const bool bMayExceedLimit = MaxLength > Config.MaxStringLength;
+
+	int32 RulesAppliedThisIteration = 0;
+	int32 ContextRulesAppliedThisIteration = 0;
+
+	// Only one block of output exists at a time
+	TTreeScratch<FLSystemSymbolBuffer> BlockScratch;
+	FLSystemSymbolBuffer& Block = *BlockScratch;
+
+	for (int32 Start = 0; Start < InputLength; Start += LSystemStreamBlockSize)
+	{
+		const int32 End = FMath::Min(Start + LSystemStreamBlockSize, InputLength);
+		const int32 Remaining = Config.MaxStringLength - OutLength;
+
+		Block.Reset();
+
+		bool bWithinLimit = true;
+		if (bMayExceedLimit)
+		{
+			bWithinLimit = RewriteRange<true>(Input, Start, End, RandomStream, Block, Remaining,
+			                                  RulesAppliedThisIteration, ContextRulesAppliedThisIteration);
 		}
 		else
 		{
-			// No rule found - keep the character unchanged (identity rule)
-			Result.AppendChar(CurrentChar);
+			RewriteRange<false>(Input, Start, End, RandomStream, Block, Remaining,
+			                    RulesAppliedThisIteration, ContextRulesAppliedThisIteration);
 		}
 
-		// Check length limit during iteration
-		if (Result.Len() > Config.MaxStringLength)
+		if (!bWithinLimit)
 		{
 			UE_LOG(LogLSystem, Warning, TEXT("String length exceeded maximum during iteration. Truncating."));
-			Result.LeftInline(Config.MaxStringLength);
+			Block.Truncate(Remaining);
+		}
+
+		OutCounts.Accumulate(Block);
+		Sink(Block.GetData(), Block.Num());
+		OutLength += Block.Num();
+
+		if (!bWithinLimit)
+		{
 			break;
 		}
 	}
@@ -518,85 +942,124 @@ FString ULSystemGenerator::ApplyRules(const FString& InputString)
 		Statistics.ContextRulesApplied += ContextRulesAppliedThisIteration;
 	}
 
-	return Result;
+	return true;
 }
 
-const FLSystemRule* ULSystemGenerator::SelectRule(TCHAR Symbol, TCHAR LeftContext, TCHAR RightContext)
+template <bool bCheckLength>
+bool ULSystemGenerator::RewriteRange(const FLSystemSymbolBuffer& Input, int32 Start, int32 End, FRandomStream& Stream,
+                                     FLSystemSymbolBuffer& Output, int32 MaxLength,
+                                     int32& OutRulesApplied, int32& OutContextRulesApplied) const
 {
-	// Find rules for this symbol
-	const TArray<const FLSystemRule*>* RulesPtr = RuleLookup.Find(Symbol);
+	// One event per rewritten range (a whole iteration, a parallel chunk or a streamed block)
+	TRACE_CPUPROFILER_EVENT_SCOPE(LSystem::RewriteRange);
 
-	if (!RulesPtr || RulesPtr->Num() == 0)
+	const int32 InputLength = Input.Num();
+	const uint8* InputData = Input.GetData();
+	const uint8* SuccessorData = RuleTable.SuccessorSymbols.GetData();
+
+	// Process each symbol
+	for (int32 i = Start; i < End; ++i)
 	{
-		return nullptr;
-	}
+		const uint8 CurrentSymbol = InputData[i];
 
-	const TArray<const FLSystemRule*>& MatchingRules = *RulesPtr;
+		// Get context symbols (read across range borders)
+		const uint8 LeftContext = (i > 0) ? InputData[i - 1] : 0;
+		const uint8 RightContext = (i < InputLength - 1) ? InputData[i + 1] : 0;
 
-	// Filter rules by context and collect matching ones
-	TArray<const FLSystemRule*> ContextMatchingRules;
-	int32 MaxSpecificity = -1;
+		// Try to find a matching rule (fast path for context-free deterministic rules)
+		const FLSystemSymbolEntry& Entry = RuleTable.Entries[CurrentSymbol];
+		const FLSystemRuleChoice* SelectedChoice;
+		if (Entry.DeterministicChoice != INDEX_NONE)
+		{
+			SelectedChoice = &RuleTable.Choices[Entry.DeterministicChoice];
+		}
+		else if (Entry.NumBuckets == 0)
+		{
+			SelectedChoice = nullptr;
+		}
+		else
+		{
+			SelectedChoice = SelectRule(Entry, LeftContext, RightContext, Stream);
+		}
 
-	for (const FLSystemRule* Rule : MatchingRules)
-	{
-		if (Rule->MatchesContext(LeftContext, RightContext))
+		if (SelectedChoice)
 		{
-			int32 Specificity = Rule->GetContextSpecificity();
-			if (Specificity > MaxSpecificity)
-			{
-				// Found more specific rule, reset array
-				ContextMatchingRules.Empty();
-				MaxSpecificity = Specificity;
-			}
+			// Apply the rule
+			Output.Append(SuccessorData + SelectedChoice->SuccessorOffset, SelectedChoice->SuccessorLength);
+			OutRulesApplied++;
 
-			if (Specificity == MaxSpecificity)
+			if (SelectedChoice->bContextSensitive)
 			{
-				ContextMatchingRules.Add(Rule);
+				OutContextRulesApplied++;
 			}
 		}
+		else
+		{
+			// No rule found - keep the symbol unchanged (identity rule)
+			Output.Add(CurrentSymbol);
+		}
+
+		// Check length limit during iteration (skipped when the prediction fits)
+		if (bCheckLength && Output.Num() > MaxLength)
+		{
+			return false;
+		}
 	}
 
-	if (ContextMatchingRules.Num() == 0)
+	return true;
+}
+
+const FLSystemRuleChoice* ULSystemGenerator::SelectRule(const FLSystemSymbolEntry& Entry,
+                                                        uint8 LeftContext, uint8 RightContext,
+                                                        FRandomStream& Stream) const
+{
+	// Buckets are ordered so that the first match holds exactly the rules
+	// of the highest specificity that match this context
+	const FLSystemRuleBucket* Bucket = nullptr;
+	const int32 EndBucket = Entry.FirstBucket + Entry.NumBuckets;
+
+	for (int32 BucketIndex = Entry.FirstBucket; BucketIndex < EndBucket; ++BucketIndex)
 	{
-		return nullptr;
+		if (RuleTable.Buckets[BucketIndex].Matches(LeftContext, RightContext))
+		{
+			Bucket = &RuleTable.Buckets[BucketIndex];
+			break;
+		}
 	}
 
-	// If only one matching rule, return it
-	if (ContextMatchingRules.Num() == 1)
+	if (Bucket == nullptr)
 	{
-		return ContextMatchingRules[0];
+		return nullptr;
 	}
 
-	// Stochastic selection among equally specific rules
-	float TotalProbability = 0.0f;
-	for (const FLSystemRule* Rule : ContextMatchingRules)
+	const FLSystemRuleChoice* Choices = RuleTable.Choices.GetData() + Bucket->FirstChoice;
+
+	// If only one matching rule, return it
+	if (Bucket->NumChoices == 1)
 	{
-		TotalProbability += Rule->Probability;
+		return &Choices[0];
 	}
 
-	if (TotalProbability <= 0.0f)
+	// Stochastic selection among equally specific rules
+	if (Bucket->TotalProbability <= 0.0f)
 	{
 		// Fallback: uniform selection
-		int32 RandomIndex = RandomStream.RandRange(0, ContextMatchingRules.Num() - 1);
-		return ContextMatchingRules[RandomIndex];
+		const int32 RandomIndex = Stream.RandRange(0, Bucket->NumChoices - 1);
+		return &Choices[RandomIndex];
 	}
 
-	// Generate random value in [0, TotalProbability)
-	float RandomValue = RandomStream.FRandRange(0.0f, TotalProbability);
-
-	// Select rule based on cumulative probability
-	float CumulativeProbability = 0.0f;
-	for (const FLSystemRule* Rule : ContextMatchingRules)
+	// Select rule based on precomputed cumulative probability
+	const float RandomValue = Stream.FRandRange(0.0f, Bucket->TotalProbability);
+	for (int32 ChoiceIndex = 0; ChoiceIndex < Bucket->NumChoices; ++ChoiceIndex)
 	{
-		CumulativeProbability += Rule->Probability;
-		if (RandomValue < CumulativeProbability)
+		if (RandomValue < Choices[ChoiceIndex].CumulativeProbability)
 		{
-			return Rule;
+			return &Choices[ChoiceIndex];
 		}
 	}
 
 	// Fallback: return last rule
-	return ContextMatchingRules.Last();
+	return &Choices[Bucket->NumChoices - 1];
 }
 
 void ULSystemGenerator::BuildRuleLookup()
@@ -631,12 +1094,159 @@ void ULSystemGenerator::BuildRuleLookup()
 		});
 	}
 
+	CompileRuleTable();
+
 	bLookupDirty = false;
 
 	UE_LOG(LogLSystem, Verbose, TEXT("Built rule lookup with %d unique predecessors"), RuleLookup.Num());
 }
 
-bool ULSystemGenerator::CheckTermination(const FString& CurrentString, int32 Iteration, FString& OutReason) const
+void ULSystemGenerator::CompileRuleTable()
+{
+	RuleTable.Reset();
+
+	// Contexts are stored as symbol bytes, 0 = none / string boundary
+	auto GetLeft = [](const FLSystemRule* Rule) -> uint8
+	{
+		return Rule->LeftContext.Len() > 0 ? static_cast<uint8>(Rule->GetLeftContextChar()) : 0;
+	};
+	auto GetRight = [](const FLSystemRule* Rule) -> uint8
+	{
+		return Rule->RightContext.Len() > 0 ? static_cast<uint8>(Rule->GetRightContextChar()) : 0;
+	};
+
+	FLSystemSymbolBuffer SuccessorBuffer;
+
+	for (const auto& Pair : RuleLookup)
+	{
+		const TCHAR Symbol = Pair.Key;
+		const TArray<const FLSystemRule*>& SymbolRules = Pair.Value;
+
+		// Non-ASCII rules are rejected by Validate()
+		if (SymbolRules.Num() == 0 || !FLSystemSymbolBuffer::IsValidSymbol(Symbol))
+		{
+			continue;
+		}
+
+		// Collect the distinct contexts of this symbol, most specific first.
+		// A left-only and a right-only rule can match at the same time, in which case rules of
+		// both are candidates - that combination gets its own bucket ahead of the single-context ones.
+		TArray<TPair<uint8, uint8>, TInlineAllocator<8>> Contexts;
+		TArray<uint8, TInlineAllocator<4>> LeftOnly;
+		TArray<uint8, TInlineAllocator<4>> RightOnly;
+
+		for (const FLSystemRule* Rule : SymbolRules)
+		{
+			const int32 Specificity = Rule->GetContextSpecificity();
+			if (Specificity == 2)
+			{
+				Contexts.AddUnique(TPair<uint8, uint8>(GetLeft(Rule), GetRight(Rule)));
+			}
+			else if (Specificity == 1)
+			{
+				if (Rule->LeftContext.Len() > 0)
+				{
+					LeftOnly.AddUnique(GetLeft(Rule));
+				}
+				else
+				{
+					RightOnly.AddUnique(GetRight(Rule));
+				}
+			}
+		}
+
+		for (const uint8 Left : LeftOnly)
+		{
+			for (const uint8 Right : RightOnly)
+			{
+				Contexts.AddUnique(TPair<uint8, uint8>(Left, Right));
+			}
+		}
+
+		for (const FLSystemRule* Rule : SymbolRules)
+		{
+			if (Rule->GetContextSpecificity() < 2)
+			{
+				Contexts.AddUnique(TPair<uint8, uint8>(GetLeft(Rule), GetRight(Rule)));
+			}
+		}
+
+		FLSystemSymbolEntry& Entry = RuleTable.Entries[Symbol];
+		Entry.FirstBucket = RuleTable.Buckets.Num();
+
+		for (const TPair<uint8, uint8>& Context : Contexts)
+		{
+			FLSystemRuleBucket Bucket;
+			Bucket.LeftContext = Context.Key;
+			Bucket.RightContext = Context.Value;
+			Bucket.Specificity = -1;
+			Bucket.FirstChoice = RuleTable.Choices.Num();
+			Bucket.NumChoices = 0;
+			Bucket.TotalProbability = 0.0f;
+
+			// Choices are the rules that win for this context: matching, at the highest specificity,
+			// in RuleLookup order so stochastic selection is stable
+			for (const FLSystemRule* Rule : SymbolRules)
+			{
+				if (Rule->MatchesContext(static_cast<TCHAR>(Context.Key), static_cast<TCHAR>(Context.Value)))
+				{
+					Bucket.Specificity = FMath::Max(Bucket.Specificity, Rule->GetContextSpecificity());
+				}
+			}
+
+			for (const FLSystemRule* Rule : SymbolRules)
+			{
+				if (Rule->GetContextSpecificity() != Bucket.Specificity ||
+				    !Rule->MatchesContext(static_cast<TCHAR>(Context.Key), static_cast<TCHAR>(Context.Value)))
+				{
+					continue;
+				}
+
+				SuccessorBuffer.SetFromString(Rule->Successor);
+				Bucket.TotalProbability += Rule->Probability;
+
+				FLSystemRuleChoice Choice;
+				Choice.Rule = Rule;
+				Choice.CumulativeProbability = Bucket.TotalProbability;
+				Choice.SuccessorOffset = RuleTable.SuccessorSymbols.Num();
+				Choice.SuccessorLength = SuccessorBuffer.Num();
+				Choice.bContextSensitive = Rule->IsContextSensitive();
+
+				RuleTable.SuccessorSymbols.Append(SuccessorBuffer.Data);
+				RuleTable.Choices.Add(Choice);
+				Bucket.NumChoices++;
+			}
+
+			RuleTable.Buckets.Add(Bucket);
+		}
+
+		Entry.NumBuckets = RuleTable.Buckets.Num() - Entry.FirstBucket;
+
+		// Output length range for the length prediction. Without a context-free rule the
+		// symbol can also fall through unchanged (length 1).
+		const FLSystemRuleBucket& LastBucket = RuleTable.Buckets.Last();
+		const bool bCanPassThrough = LastBucket.LeftContext != 0 || LastBucket.RightContext != 0;
+
+		Entry.MinOutputLength = bCanPassThrough ? 1 : MAX_int32;
+		Entry.MaxOutputLength = bCanPassThrough ? 1 : 0;
+		for (int32 ChoiceIndex = RuleTable.Buckets[Entry.FirstBucket].FirstChoice; ChoiceIndex < RuleTable.Choices.Num(); ++ChoiceIndex)
+		{
+			Entry.MinOutputLength = FMath::Min(Entry.MinOutputLength, RuleTable.Choices[ChoiceIndex].SuccessorLength);
+			Entry.MaxOutputLength = FMath::Max(Entry.MaxOutputLength, RuleTable.Choices[ChoiceIndex].SuccessorLength);
+		}
+
+		// Single context-free rule: selection always returns it, so skip it entirely
+		if (SymbolRules.Num() == 1 && !SymbolRules[0]->IsContextSensitive())
+		{
+			Entry.DeterministicChoice = RuleTable.Buckets[Entry.FirstBucket].FirstChoice;
+		}
+	}
+
+	UE_LOG(LogLSystem, Verbose, TEXT("Compiled rule table: %d buckets, %d choices, %d successor symbols"),
+	       RuleTable.Buckets.Num(), RuleTable.Choices.Num(), RuleTable.SuccessorSymbols.Num());
+}
+
+bool ULSystemGenerator::CheckTermination(const FLSystemSymbolBuffer& CurrentString, int32 Iteration, FString& OutReason) const
 {
 	// Check iteration limit
 	if (Iteration >= Config.MaxIterations)
@@ -646,7 +1256,7 @@ bool ULSystemGenerator::CheckTermination(const FString& CurrentString, int32 Ite
 	}
 
 	// Check string length limit
-	if (CurrentString.Len() >= Config.MaxStringLength)
+	if (CurrentString.Num() >= Config.MaxStringLength)
 	{
 		OutReason = FString::Printf(TEXT("Reached maximum string length (%d)"), Config.MaxStringLength);
 		return true;
@@ -662,51 +1272,54 @@ bool ULSystemGenerator::CheckTermination(const FString& CurrentString, int32 Ite
 	return false;
 }
 
-void ULSystemGenerator::UpdateStatistics(const FString& FinalString, int32 Iterations, double StartTime)
+void ULSystemGenerator::UpdateStatistics(int32 FinalLength, const FLSystemSymbolCounts& FinalCounts, int32 Iterations, double StartTime)
 {
 	FScopeLock Lock(&StateLock);
 
 	const double EndTime = FPlatformTime::Seconds();
 
 	Statistics.TotalIterations = Iterations;
-	Statistics.FinalStringLength = FinalString.Len();
+	Statistics.FinalStringLength = FinalLength;
 	Statistics.GenerationTimeMs = static_cast<float>((EndTime - StartTime) * 1000.0);
+	Statistics.MaxBracketDepth = FinalCounts.MaxBracketDepth;
 
 	// Calculate symbol counts
-	CalculateSymbolCounts(FinalString);
+	CalculateSymbolCounts(FinalCounts.Histogram);
 
 	UE_LOG(LogLSystem, Log, TEXT("Generation complete: %s"), *Statistics.ToString());
 }
 
-void ULSystemGenerator::CalculateSymbolCounts(const FString& InputString)
+void ULSystemGenerator::CalculateSymbolCounts(const int32* SymbolHistogram)
 {
 	Statistics.SymbolCounts.Empty();
 
-	for (int32 i = 0; i < InputString.Len(); ++i)
+	// Convert the used entries of the byte alphabet for Blueprint
+	for (int32 Symbol = 0; Symbol < FLSystemRuleTable::NumSymbols; ++Symbol)
 	{
-		FString Symbol = FString::Chr(InputString[i]);
-		int32& Count = Statistics.SymbolCounts.FindOrAdd(Symbol);
-		Count++;
+		if (SymbolHistogram[Symbol] > 0)
+		{
+			Statistics.SymbolCounts.Add(FString::Chr(static_cast<TCHAR>(Symbol)), SymbolHistogram[Symbol]);
+		}
 	}
 }
 
-void ULSystemGenerator::LogIteration(int32 Iteration, const FString& CurrentString)
+void ULSystemGenerator::LogIteration(int32 Iteration, const FLSystemSymbolBuffer& CurrentString)
 {
 	if (Config.bEnableDetailedLogging)
 	{
-		// Truncate string for logging if too long
-		FString LogString = CurrentString;
-		if (LogString.Len() > 200)
-		{
-			LogString = LogString.Left(100) + TEXT("...") + LogString.Right(97);
-		}
+		// Truncate string for logging if too long (only the logged part is converted)
+		const int32 Length = CurrentString.Num();
+		const FString LogString = (Length > 200)
+			? CurrentString.ToString(0, 100) + TEXT("...") + CurrentString.ToString(Length - 97, 97)
+			: CurrentString.ToString();
 
 		UE_LOG(LogLSystem, Log, TEXT("Iteration %d: Length=%d, String=%s"),
-		       Iteration, CurrentString.Len(), *LogString);
+		       Iteration, Length, *LogString);
 	}
 }
 
-FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool bAsync)
+FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool bAsync,
+                                                         const FLSystemSymbolSink* FinalIterationSink)
 {
 	// Validate configuration
 	FString ValidationError;
@@ -740,19 +1353,33 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 	{
 		FScopeLock Lock(&StateLock);
 		State.bIsGenerating = true;
-		State.CurrentString = CurrentAxiom;
+		State.CurrentSymbols.SetFromString(CurrentAxiom);
 		State.CurrentIteration = 0;
-		State.History.Empty();
+		State.SymbolHistory.Reset();
 		State.ProgressPercent = 0.0f;
 		Statistics.Reset();
+		bCanContinueGeneration = false;
 	}
 
-	FString CurrentString = CurrentAxiom;
-	TArray<FString> History;
+	// Ping-pong buffers: each iteration rewrites CurrentString into NextString, then they swap.
+	// Both come from the thread's scratch pool, so repeated generations reuse their capacity.
+	TTreeScratch<FLSystemSymbolBuffer> CurrentScratch;
+	TTreeScratch<FLSystemSymbolBuffer> NextScratch;
+	FLSystemSymbolBuffer& CurrentString = *CurrentScratch;
+	FLSystemSymbolBuffer& NextString = *NextScratch;
+	CurrentString.SetFromString(CurrentAxiom);
+
+	// History is stored once, in an arena shared by the state and the result.
+	// A fresh arena per generation keeps histories handed out earlier immutable.
+	FLSystemSymbolHistoryPtr History;
 
 	if (Config.bStoreHistory)
 	{
-		History.Add(CurrentString);
+		History = MakeShared<FLSystemSymbolHistory, ESPMode::ThreadSafe>();
+		History->Add(CurrentString);
+
+		FScopeLock Lock(&StateLock);
+		State.SymbolHistory = History;
 	}
 
 	// Log initial state
@@ -760,6 +1387,11 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 
 	FString TerminationReason;
 
+	// Histogram and nesting of the final string (filled while streaming, or from CurrentString at the end)
+	FLSystemSymbolCounts FinalCounts;
+	int32 StreamedLength = 0;
+	bool bFinalIterationStreamed = false;
+
 	// Main generation loop
 	for (int32 i = 0; i < Iterations; ++i)
 	{
@@ -770,31 +1402,56 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 			break;
 		}
 
-		// Store previous string for change detection
-		FString PreviousString = CurrentString;
+		// Streaming mode: expand the final iteration straight into the sink
+		if (FinalIterationSink && i == Iterations - 1)
+		{
+			if (!StreamRules(CurrentString, *FinalIterationSink, FinalCounts, StreamedLength))
+			{
+				UE_LOG(LogLSystem, Log, TEXT("Generation terminated early: iteration %d would exceed maximum string length (%d)"),
+				       i + 1, Config.MaxStringLength);
+				break;
+			}
 
-		// Apply rules
-		CurrentString = ApplyRules(CurrentString);
+			bFinalIterationStreamed = true;
+
+			{
+				FScopeLock Lock(&StateLock);
+				State.CurrentIteration = i + 1;
+				State.ProgressPercent = 1.0f;
+			}
+
+			UE_LOG(LogLSystem, Log, TEXT("Iteration %d: Length=%d (streamed)"), i + 1, StreamedLength);
+			break;
+		}
+
+		// Apply rules (skipped up front if the result cannot fit in MaxStringLength)
+		if (!ApplyRules(CurrentString, NextString))
+		{
+			UE_LOG(LogLSystem, Log, TEXT("Generation terminated early: iteration %d would exceed maximum string length (%d)"),
+			       i + 1, Config.MaxStringLength);
+			break;
+		}
+
+		// Check if string changed (detect potential infinite loops with no effect)
+		const bool bStringChanged = (NextString != CurrentString);
+
+		// The old string stays in NextString as scratch space for the next iteration
+		Swap(CurrentString, NextString);
 
 		// Update state
 		{
 			FScopeLock Lock(&StateLock);
-			State.CurrentString = CurrentString;
+			State.CurrentSymbols = CurrentString;
 			State.CurrentIteration = i + 1;
 			State.ProgressPercent = static_cast<float>(i + 1) / static_cast<float>(Iterations);
 
-			if (Config.bStoreHistory)
+			// Appended under the lock since GetCurrentState may read the shared arena concurrently
+			if (History.IsValid())
 			{
-				State.History.Add(CurrentString);
+				History->Add(CurrentString);
 			}
 		}
 
-		// Store in local history
-		if (Config.bStoreHistory)
-		{
-			History.Add(CurrentString);
-		}
-
 		// Log iteration
 		LogIteration(i + 1, CurrentString);
 
@@ -815,10 +1472,10 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 		if (OnIterationComplete.IsBound())
 		{
 			int32 IterNum = i + 1;
-			FString IterString = CurrentString;
+			FString IterString = CurrentString.ToString();
 			if (bAsync)
 			{
-				AsyncTask(ENamedThreads::GameThread, [this, IterNum, IterString]()
+				AsyncTask(ENamedThreads::GameThread, [this, IterNum, IterString = MoveTemp(IterString)]()
 				{
 					if (IsValid())
 					{
@@ -832,8 +1489,7 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 			}
 		}
 
-		// Check if string changed (detect potential infinite loops with no effect)
-		if (PreviousString == CurrentString)
+		if (!bStringChanged)
 		{
 			UE_LOG(LogLSystem, Log, TEXT("String unchanged at iteration %d, stopping"), i + 1);
 			break;
@@ -847,13 +1503,25 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 		State.ProgressPercent = 1.0f;
 	}
 
+	// Generation ended before the streamed iteration - hand over the (already built) final string
+	if (FinalIterationSink && !bFinalIterationStreamed && !bCancelRequested)
+	{
+		(*FinalIterationSink)(CurrentString.GetData(), CurrentString.Num());
+	}
+
+	if (!bFinalIterationStreamed)
+	{
+		FinalCounts.Accumulate(CurrentString);
+	}
+
 	// Update statistics
 	int32 ActualIterations;
 	{
 		FScopeLock Lock(&StateLock);
 		ActualIterations = State.CurrentIteration;
 	}
-	UpdateStatistics(CurrentString, ActualIterations, StartTime);
+	UpdateStatistics(bFinalIterationStreamed ? StreamedLength : CurrentString.Num(), FinalCounts,
+	                 ActualIterations, StartTime);
 
 	// Handle cancellation
 	if (bCancelRequested)
@@ -861,6 +1529,9 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 		return FLSystemGenerationResult::Cancelled();
 	}
 
+	// A streamed final iteration never reached State, so there is nothing to continue from
+	bCanContinueGeneration = !bFinalIterationStreamed;
+
 	// Copy statistics
 	FLSystemStatistics FinalStats;
 	{
@@ -868,10 +1539,19 @@ FLSystemGenerationResult ULSystemGenerator::DoGeneration(int32 Iterations, bool
 		FinalStats = Statistics;
 	}
 
-	return FLSystemGenerationResult::Success(CurrentString, History, FinalStats);
+	// In streaming mode the final symbols went to the sink. Otherwise they are moved into the result:
+	// copying the largest buffer of the pipeline just to keep its capacity pooled costs more than the
+	// pool regrowing that slot (and big buffers are not retained anyway).
+	FLSystemSymbolBuffer FinalSymbols;
+	if (!FinalIterationSink)
+	{
+		FinalSymbols = MoveTemp(CurrentString);
+	}
+
+	return FLSystemGenerationResult::Success(MoveTemp(FinalSymbols), MoveTemp(History), FinalStats);
 }
 
-void ULSystemGenerator::HandleAsyncComplete(const FLSystemGenerationResult& Result)
+void ULSystemGenerator::HandleAsyncComplete(FLSystemGenerationResult Result)
 {
 	{
 		FScopeLock Lock(&StateLock);
@@ -879,6 +1559,9 @@ void ULSystemGenerator::HandleAsyncComplete(const FLSystemGenerationResult& Resu
 		State.ProgressPercent = 1.0f;
 	}
 
+	// Blueprint listeners receive the FString form
+	Result.MaterializeStrings();
+
 	// Fire completion delegate
 	OnGenerationComplete.Broadcast(Result);
 
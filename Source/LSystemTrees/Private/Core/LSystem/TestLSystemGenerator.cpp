@@ -6,7 +6,17 @@
 #include "Core/LSystem/LSystemRule.h"
 #include "Core/TreeGeometry/TurtleInterpreter.h"
 #include "Core/TreeGeometry/TreeGeometry.h"
+#include "Core/TreeGeometry/TreeMeshBaker.h"
+#include "Core/TreeGeometry/TreeSimplifier.h"
+#include "Core/Utilities/DebugDraw.h"
 #include "Core/Utilities/TreeMath.h"
+#include "Core/Utilities/TreeScratch.h"
+#include "Components/ProceduralTreeComponent.h"
+#include "Subsystems/TreeGenerationSubsystem.h"
+#include "MeshDescription.h"
+#include "PhysicsEngine/SphylElem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 ATestLSystemGenerator::ATestLSystemGenerator()
 	: bVerboseLogging(true)
@@ -15,6 +25,7 @@ ATestLSystemGenerator::ATestLSystemGenerator()
 	, PassedTests(0)
 	, FailedTests(0)
 	, TotalTestTimeMs(0.0f)
+	, TreeGeneratedCount(0)
 {
 	PrimaryActorTick.bCanEverTick = false;
 }
@@ -238,6 +249,82 @@ bool ATestLSystemGenerator::TestStochasticGeneration()
 		              FString::Printf(TEXT("A=%d, B=%d, Ratio=%.2f"), CountA, CountB, Ratio));
 	}
 
+	// Test 4: Parallel rewrite matches sequential for deterministic rules
+	{
+		ULSystemGenerator* SeqGen = CreateTestGenerator();
+		SeqGen->Config.MaxStringLength = 1000000;
+		SeqGen->Config.bEnableDetailedLogging = false;
+		SeqGen->Initialize(TEXT("F"));
+		SeqGen->AddRuleSimple(TEXT("F"), TEXT("F[+F]F"));
+
+		ULSystemGenerator* ParGen = CreateTestGenerator();
+		ParGen->Config = SeqGen->Config;
+		ParGen->Config.bParallelRewrite = true;
+		ParGen->Config.ParallelChunkSize = 1024;
+		ParGen->Config.ParallelMinLength = 0;
+		ParGen->Initialize(TEXT("F"));
+		ParGen->AddRuleSimple(TEXT("F"), TEXT("F[+F]F"));
+
+		FString SeqResult = SeqGen->GenerateString(7);
+		FString ParResult = ParGen->GenerateString(7);
+
+		bool bPassed = (SeqResult == ParResult);
+		LogTestResult(TEXT("ParallelMatchesSequential"), bPassed,
+		              FString::Printf(TEXT("Length: %d vs %d"), SeqResult.Len(), ParResult.Len()));
+	}
+
+	// Test 5: Parallel rewrite is reproducible with the same seed
+	{
+		FString Results[2];
+		for (int32 Run = 0; Run < 2; ++Run)
+		{
+			ULSystemGenerator* Gen = CreateTestGenerator();
+			Gen->Config.MaxStringLength = 1000000;
+			Gen->Config.bEnableDetailedLogging = false;
+			Gen->Config.bParallelRewrite = true;
+			Gen->Config.ParallelChunkSize = 1024;
+			Gen->Config.ParallelMinLength = 0;
+			Gen->Initialize(TEXT("F"));
+			Gen->AddRuleStochastic(TEXT("F"), TEXT("F[+F]F"), 0.5f);
+			Gen->AddRuleStochastic(TEXT("F"), TEXT("F[-F]F"), 0.5f);
+			Gen->SetRandomSeed(4242);
+
+			Results[Run] = Gen->GenerateString(7);
+		}
+
+		bool bPassed = (Results[0] == Results[1]);
+		LogTestResult(TEXT("ParallelSeedReproducibility"), bPassed,
+		              bPassed ? TEXT("") : TEXT("Results differ with same seed"));
+	}
+
+	// Test 6: Growing one iteration continues the retained string and random stream
+	{
+		ULSystemGenerator* GrowGen = CreateTestGenerator();
+		GrowGen->Initialize(TEXT("F"));
+		GrowGen->AddRuleStochastic(TEXT("F"), TEXT("F[+F]"), 0.5f);
+		GrowGen->AddRuleStochastic(TEXT("F"), TEXT("F[-F]F"), 0.5f);
+		GrowGen->SetRandomSeed(4242);
+
+		FLSystemGenerationResult Grown = GrowGen->GenerateSymbols(3);
+		const bool bCouldContinue = GrowGen->CanContinueGeneration();
+		Grown = GrowGen->GrowOneIterationSymbols();
+
+		ULSystemGenerator* FullGen = CreateTestGenerator();
+		FullGen->Initialize(TEXT("F"));
+		FullGen->AddRuleStochastic(TEXT("F"), TEXT("F[+F]"), 0.5f);
+		FullGen->AddRuleStochastic(TEXT("F"), TEXT("F[-F]F"), 0.5f);
+		FullGen->SetRandomSeed(4242);
+
+		FLSystemGenerationResult Full = FullGen->GenerateSymbols(4);
+
+		bool bPassed = bCouldContinue && Grown.bSuccess &&
+		               Grown.Symbols == Full.Symbols &&
+		               Grown.Stats.TotalIterations == 4 &&
+		               GrowGen->GetCurrentState().CurrentIteration == 4;
+		LogTestResult(TEXT("GrowOneIteration"), bPassed,
+		              FString::Printf(TEXT("Lengths: %d vs %d"), Grown.Symbols.Num(), Full.Symbols.Num()));
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -324,6 +411,23 @@ bool ATestLSystemGenerator::TestContextSensitive()
 		VerifyOutput(Result, TEXT("AXCAYD"), TEXT("MultipleContextRules"));
 	}
 
+	// Test 7: Left-only and right-only rules matching the same symbol compete
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("ABCAB"));
+		Gen->AddContextRule(TEXT("A"), TEXT("B"), TEXT(""), TEXT("X"));
+		Gen->AddContextRule(TEXT(""), TEXT("B"), TEXT("C"), TEXT("Y"));
+
+		FString Result = Gen->GenerateString(1);
+
+		// First B has both contexts (either rule may win), last B only matches A<B
+		bool bPassed = Result.Len() == 5 &&
+		               (Result[1] == TEXT('X') || Result[1] == TEXT('Y')) &&
+		               Result[4] == TEXT('X');
+		LogTestResult(TEXT("LeftAndRightContextUnion"), bPassed,
+		              FString::Printf(TEXT("Result: %s"), *Result));
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -375,6 +479,25 @@ bool ATestLSystemGenerator::TestEdgeCases()
 		bool bPassed = Result.Len() <= 50;
 		LogTestResult(TEXT("MaxStringLength"), bPassed,
 		              FString::Printf(TEXT("Length: %d"), Result.Len()));
+
+		// The overflowing iteration is predicted and skipped, so the last full string is kept
+		bPassed = Result.Len() == 32;
+		LogTestResult(TEXT("MaxStringLengthNoTruncation"), bPassed,
+		              FString::Printf(TEXT("Length: %d (expected 32)"), Result.Len()));
+	}
+
+	// Test 3b: Length estimate is exact for deterministic rules
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("FX"));
+		Gen->AddRuleSimple(TEXT("F"), TEXT("F[+F]F"));
+
+		const int32 Estimate = Gen->EstimateStringLength(4);
+		const int32 Actual = Gen->GenerateString(4).Len();
+
+		bool bPassed = Estimate == Actual;
+		LogTestResult(TEXT("EstimateStringLength"), bPassed,
+		              FString::Printf(TEXT("Estimate: %d, Actual: %d"), Estimate, Actual));
 	}
 
 	// Test 4: MaxIterations enforcement
@@ -416,6 +539,166 @@ bool ATestLSystemGenerator::TestEdgeCases()
 		LogTestResult(TEXT("StatisticsAccuracy"), bPassed);
 	}
 
+	// Test 7: Non-ASCII symbols are rejected (symbols are stored as bytes)
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(FString(TEXT("F")) + FString::Chr(0x00E9));
+		Gen->AddRuleSimple(TEXT("F"), TEXT("FF"));
+
+		FLSystemGenerationResult Result = Gen->Generate(1);
+
+		bool bPassed = !Result.bSuccess;
+		LogTestResult(TEXT("NonAsciiAxiomFails"), bPassed,
+		              bPassed ? TEXT("") : TEXT("Should have failed"));
+	}
+
+	// Test 8: Native symbols match the Blueprint string
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("F"));
+		Gen->AddRuleSimple(TEXT("F"), TEXT("F[+F]F"));
+
+		FLSystemGenerationResult Result = Gen->Generate(2);
+
+		bool bPassed = Result.bSuccess && Result.Symbols.ToString() == Result.GeneratedString;
+		LogTestResult(TEXT("SymbolBufferRoundTrip"), bPassed);
+	}
+
+	// Test 9: History is opt-in and shared between the result and the generator state
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("A"));
+		Gen->AddRuleSimple(TEXT("A"), TEXT("AB"));
+		Gen->AddRuleSimple(TEXT("B"), TEXT("A"));
+
+		FLSystemGenerationResult NoHistory = Gen->GenerateSymbols(3);
+
+		Gen->Config.bStoreHistory = true;
+		FLSystemGenerationResult Result = Gen->Generate(3);
+		FLSystemState CurrentState = Gen->GetCurrentState();
+
+		bool bPassed = !NoHistory.SymbolHistory.IsValid() &&
+		               Result.SymbolHistory.IsValid() &&
+		               Result.SymbolHistory == CurrentState.SymbolHistory &&
+		               Result.IterationHistory.Num() == 4 &&
+		               Result.IterationHistory[0] == TEXT("A") &&
+		               Result.IterationHistory[2] == TEXT("ABA") &&
+		               Result.SymbolHistory->ToBuffer(3) == Result.Symbols;
+		LogTestResult(TEXT("SharedIterationHistory"), bPassed,
+		              FString::Printf(TEXT("History entries: %d"), Result.IterationHistory.Num()));
+	}
+
+	// Test 10: Generation cache keys are content-addressed and entries are shared
+	{
+		FTreeGenerationRequest RequestA;
+		RequestA.Axiom = TEXT("F");
+		RequestA.Rules.Add(FLSystemRule(TEXT("F"), TEXT("F[+F]F")));
+		RequestA.Iterations = 3;
+		RequestA.Seed = 7;
+
+		FTreeGenerationRequest RequestB = RequestA;
+		FTreeGenerationRequest RequestC = RequestA;
+		RequestC.TurtleConfig.DefaultAngle += 1.0f;
+
+		RequestA.ComputeKeys();
+		RequestB.ComputeKeys();
+		RequestC.ComputeKeys();
+
+		const FSHAHash KeyA = RequestA.CacheKey;
+		bool bKeysOk = KeyA == RequestB.CacheKey && !(KeyA == RequestC.CacheKey);
+
+		// Stage keys only change downstream of the edited settings
+		FTreeGenerationRequest RequestD = RequestA;
+		RequestD.GeometryConfig.BarkUVTiling *= 2.0f;
+		RequestD.ComputeKeys();
+
+		bKeysOk &= RequestC.LSystemKey == RequestA.LSystemKey && !(RequestC.TurtleKey == RequestA.TurtleKey);
+		bKeysOk &= RequestD.LSystemKey == RequestA.LSystemKey && RequestD.TurtleKey == RequestA.TurtleKey &&
+		           !(RequestD.CacheKey == RequestA.CacheKey);
+
+		TSharedRef<FTreeGeneratedData, ESPMode::ThreadSafe> Data = MakeShared<FTreeGeneratedData, ESPMode::ThreadSafe>();
+		Data->Skeleton.AddSegment(FVector::ZeroVector, FVector(0, 0, 100), FVector::UpVector, 5.0f, 4.0f, 0, -1);
+
+		// The cache is process-wide: store the fake tree under a key no request produces, and drop it again
+		FSHA1 TestHasher;
+		FTreeGenerationCache::HashString(TestHasher, TEXT("TestLSystemGenerator.GenerationCacheKeys"));
+		TestHasher.Final();
+		FSHAHash TestKey;
+		TestHasher.GetHash(TestKey.Hash);
+
+		FTreeGenerationCache& Cache = FTreeGenerationCache::Get();
+		Cache.Add(TestKey, Data);
+		FTreeGeneratedDataPtr Found = Cache.Find(TestKey);
+		Cache.Remove(TestKey);
+
+		// Caching may be disabled through the budget CVar
+		bool bShared = FTreeGenerationCache::GetBudgetBytes() == 0 || Found == FTreeGeneratedDataPtr(Data);
+		bool bRemoved = !Cache.Find(TestKey).IsValid();
+
+		bool bPassed = bKeysOk && bShared && bRemoved;
+		LogTestResult(TEXT("GenerationCacheKeys"), bPassed,
+		              FString::Printf(TEXT("Cached trees: %d"), Cache.Num()));
+	}
+
+	// Test 11: Generated trees survive the persistent cache's binary round trip
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		FTreeGeneratedData Original;
+		Original.Symbols.SetFromString(TEXT("F[+F]L"));
+		Original.Skeleton.AddSegment(FVector::ZeroVector, FVector(0, 0, 100), FVector::UpVector, 5.0f, 4.0f, 0, -1);
+		Original.Skeleton.AddLeaf(FVector(0, 0, 100), FVector::ForwardVector, FVector::UpVector, FVector2D(10.0f, 15.0f), 12.0f, 1);
+
+		Original.LODs.Add(Geo->GenerateMeshFromSkeleton(Original.Skeleton, 8, true));
+
+		TArray<uint8> Blob;
+		FMemoryWriter Writer(Blob);
+		Original.Serialize(Writer);
+
+		FTreeGeneratedData Loaded;
+		FMemoryReader Reader(Blob);
+		bool bLoaded = Loaded.Serialize(Reader);
+
+		bool bPassed = bLoaded &&
+		               Loaded.Symbols == Original.Symbols &&
+		               Loaded.Skeleton.NumSegments() == 1 &&
+		               Loaded.Skeleton.SegmentEnds[0].Equals(Original.Skeleton.SegmentEnds[0]) &&
+		               Loaded.Skeleton.NumLeaves() == 1 &&
+		               Loaded.Skeleton.LeafRotations[0] == Original.Skeleton.LeafRotations[0] &&
+		               Loaded.LODs.Num() == 1 &&
+		               Loaded.LODs[0].Branches.Triangles == Original.LODs[0].Branches.Triangles &&
+		               Loaded.LODs[0].GetVertexCount() == Original.LODs[0].GetVertexCount();
+
+		// A truncated blob must be rejected instead of producing garbage
+		Blob.SetNum(Blob.Num() / 2);
+		FTreeGeneratedData Truncated;
+		FMemoryReader TruncatedReader(Blob);
+		bPassed &= !Truncated.Serialize(TruncatedReader);
+
+		LogTestResult(TEXT("PersistentCacheRoundTrip"), bPassed,
+		              FString::Printf(TEXT("Blob: %d bytes"), Blob.Num() * 2));
+	}
+
+	// Test 12: Only fixed seeds are persisted (randomized ones can never be requested again)
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+
+		Tree->bRandomizeSeed = true;
+		FTreeGenerationRequest RandomRequest;
+		Tree->BuildGenerationRequest(RandomRequest);
+
+		Tree->bRandomizeSeed = false;
+		FTreeGenerationRequest FixedRequest;
+		Tree->BuildGenerationRequest(FixedRequest);
+
+		bool bPassed = !RandomRequest.bPersistent && FixedRequest.bPersistent;
+		LogTestResult(TEXT("PersistOnlyFixedSeeds"), bPassed,
+		              FString::Printf(TEXT("Random: %s, Fixed: %s"),
+		                              RandomRequest.bPersistent ? TEXT("Persisted") : TEXT("Skipped"),
+		                              FixedRequest.bPersistent ? TEXT("Persisted") : TEXT("Skipped")));
+		Tree->DestroyComponent();
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -582,23 +865,90 @@ bool ATestLSystemGenerator::TestAsyncGeneration()
 	UE_LOG(LogLSystem, Log, TEXT(""));
 	UE_LOG(LogLSystem, Log, TEXT("--- TestAsyncGeneration ---"));
 
+	const int32 InitialFailed = FailedTests;
+
 	// Note: This test is harder to run synchronously.
 	// For Blueprint testing, you can bind to delegates.
 
-	ULSystemGenerator* Gen = CreateTestGenerator();
-	Gen->Initialize(TEXT("F"));
-	Gen->AddRuleSimple(TEXT("F"), TEXT("FF"));
+	// Test 1: Async generation can be started
+	{
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("F"));
+		Gen->AddRuleSimple(TEXT("F"), TEXT("FF"));
+
+		// Just verify that async can be started
+		Gen->GenerateAsync(3);
 
-	// Just verify that async can be started
-	Gen->GenerateAsync(3);
+		bool bPassed = Gen->IsGenerating();
+		LogTestResult(TEXT("AsyncStarted"), bPassed);
 
-	bool bPassed = Gen->IsGenerating();
-	LogTestResult(TEXT("AsyncStarted"), bPassed);
+		// Cancel immediately for cleanup
+		Gen->CancelAsyncGeneration();
+	}
 
-	// Cancel immediately for cleanup
-	Gen->CancelAsyncGeneration();
+	// Test 2: Cancelling a component's async generation keeps the displayed tree and reports nothing
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 3;
+		Tree->bRandomizeSeed = false;
+		Tree->bUseGenerationCache = false;
+		Tree->GenerateTree();
+
+		const FTreeGeneratedDataPtr Displayed = Tree->CachedData;
+		const int32 Vertices = Tree->GetVertexCount();
+
+		TreeGeneratedCount = 0;
+		Tree->OnTreeGenerated.AddDynamic(this, &ATestLSystemGenerator::HandleTreeGenerated);
+
+		// New inputs, so the request cannot be answered from the displayed data
+		Tree->Iterations = 4;
+		Tree->GenerateTreeAsync();
+		const bool bStarted = Tree->IsGeneratingTree();
+		Tree->CancelTreeGeneration();
+
+		// The cancelled stages finish on workers; their completion sees the cancel and applies nothing
+		bool bPassed = bStarted && !Tree->IsGeneratingTree() && Tree->CachedData == Displayed &&
+		               Vertices > 0 && Tree->GetVertexCount() == Vertices && TreeGeneratedCount == 0;
+		LogTestResult(TEXT("AsyncCancelKeepsTree"), bPassed,
+		              FString::Printf(TEXT("Started: %s, Vertices: %d -> %d, Broadcasts: %d"),
+		                              bStarted ? TEXT("Yes") : TEXT("No"), Vertices, Tree->GetVertexCount(), TreeGeneratedCount));
+
+		Tree->OnTreeGenerated.RemoveDynamic(this, &ATestLSystemGenerator::HandleTreeGenerated);
+		Tree->DestroyComponent();
+	}
 
-	return bPassed;
+	// Test 3: A memory cache hit is applied immediately, without launching the pipeline tasks
+	if (FTreeGenerationCache::GetBudgetBytes() > 0)
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 3;
+		Tree->bRandomizeSeed = false;
+
+		// Seed the process-wide cache directly (a real generation would also write the persistent cache)
+		TSharedRef<FTreeGeneratedData, ESPMode::ThreadSafe> Data = MakeShared<FTreeGeneratedData, ESPMode::ThreadSafe>();
+		Data->Skeleton.AddSegment(FVector::ZeroVector, FVector(0, 0, 100), FVector::UpVector, 5.0f, 4.0f, 0, -1);
+		Data->LODs.Add(NewObject<UTreeGeometry>(this)->GenerateMeshFromSkeleton(Data->Skeleton, 8, false));
+
+		FTreeGenerationRequest Request;
+		Tree->BuildGenerationRequest(Request);
+		FTreeGenerationCache::Get().Add(Request.CacheKey, Data);
+
+		TreeGeneratedCount = 0;
+		Tree->OnTreeGenerated.AddDynamic(this, &ATestLSystemGenerator::HandleTreeGenerated);
+		Tree->GenerateTreeAsync();
+
+		const bool bShared = Tree->CachedData == FTreeGeneratedDataPtr(Data);
+		bool bPassed = bShared && !Tree->ActiveGeneration.IsValid() && !Tree->IsGeneratingTree() &&
+		               Tree->GetLastGenerationBreakdown().bFromCache && TreeGeneratedCount == 1;
+		LogTestResult(TEXT("AsyncCacheHitImmediate"), bPassed,
+		              FString::Printf(TEXT("Shared: %s, Broadcasts: %d"), bShared ? TEXT("Yes") : TEXT("No"), TreeGeneratedCount));
+
+		FTreeGenerationCache::Get().Remove(Request.CacheKey);
+		Tree->OnTreeGenerated.RemoveDynamic(this, &ATestLSystemGenerator::HandleTreeGenerated);
+		Tree->DestroyComponent();
+	}
+
+	return FailedTests == InitialFailed;
 }
 
 // ============================================================================
@@ -733,6 +1083,204 @@ bool ATestLSystemGenerator::TestTurtleInterpreter()
 		              FString::Printf(TEXT("MaxDepth: %d"), Interp->GetMaxDepth()));
 	}
 
+	// Test 8: Streaming the final iteration matches interpreting the full string
+	{
+		FTurtleConfig Config;
+		Config.RandomSeed = 777;
+
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("F"));
+		Gen->AddRuleStochastic(TEXT("F"), TEXT("F[+F]F[-FL]"), 0.6f);
+		Gen->AddRuleStochastic(TEXT("F"), TEXT("F[&FL]F"), 0.4f);
+		Gen->SetRandomSeed(2024);
+
+		FLSystemGenerationResult FullResult = Gen->GenerateSymbols(4);
+
+		UTurtleInterpreter* FullInterp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> FullSegments;
+		TArray<FLeafData> FullLeaves;
+		FullInterp->InterpretSymbols(FullResult.Symbols, Config, FullSegments, FullLeaves);
+
+		UTurtleInterpreter* StreamInterp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> StreamSegments;
+		TArray<FLeafData> StreamLeaves;
+		TArray<uint8> StreamedSymbols;
+		StreamInterp->BeginStream(Config);
+		FLSystemGenerationResult StreamResult = Gen->GenerateStreamed(4, [StreamInterp, &StreamedSymbols](const uint8* Symbols, int32 Count)
+		{
+			StreamedSymbols.Append(Symbols, Count);
+			StreamInterp->ProcessSymbols(Symbols, Count);
+		});
+		StreamInterp->EndStream(StreamSegments, StreamLeaves);
+
+		// Symbol by symbol, then the skeleton built from them
+		bool bSameSymbols = StreamedSymbols == FullResult.Symbols.Data;
+
+		bool bSameSkeleton = StreamSegments.Num() == FullSegments.Num() &&
+		                     StreamLeaves.Num() == FullLeaves.Num();
+		for (int32 i = 0; bSameSkeleton && i < FullSegments.Num(); ++i)
+		{
+			bSameSkeleton = StreamSegments[i].StartPosition.Equals(FullSegments[i].StartPosition, 0.01f) &&
+			                StreamSegments[i].EndPosition.Equals(FullSegments[i].EndPosition, 0.01f) &&
+			                StreamSegments[i].Depth == FullSegments[i].Depth;
+		}
+		for (int32 i = 0; bSameSkeleton && i < FullLeaves.Num(); ++i)
+		{
+			bSameSkeleton = StreamLeaves[i].Position.Equals(FullLeaves[i].Position, 0.01f);
+		}
+
+		bool bPassed = StreamResult.bSuccess &&
+		               StreamResult.Symbols.IsEmpty() &&
+		               StreamResult.Stats.FinalStringLength == FullResult.Symbols.Num() &&
+		               bSameSymbols && bSameSkeleton;
+		LogTestResult(TEXT("StreamedFinalIteration"), bPassed,
+		              FString::Printf(TEXT("Symbols match: %s, Skeleton match: %s, Segments: %d vs %d, Leaves: %d vs %d"),
+		                              bSameSymbols ? TEXT("Yes") : TEXT("No"),
+		                              bSameSkeleton ? TEXT("Yes") : TEXT("No"),
+		                              StreamSegments.Num(), FullSegments.Num(),
+		                              StreamLeaves.Num(), FullLeaves.Num()));
+	}
+
+	// Test 9: Incremental interpretation only rebuilds after the shared prefix, bit for bit
+	{
+		FTurtleConfig Config;
+		Config.RandomSeed = 99;
+
+		// Symbols 1023-1024 are one yaw run across the first checkpoint boundary
+		FString Base = TEXT("FF");
+		for (int32 i = 0; i < 400; ++i)
+		{
+			Base += TEXT("F++");
+		}
+		for (int32 i = 0; i < 100; ++i)
+		{
+			Base += TEXT("F[+F]");
+		}
+
+		UTurtleInterpreter* IncrementalInterp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> IncrementalSegments;
+		TArray<FLeafData> IncrementalLeaves;
+		IncrementalInterp->InterpretSymbolsIncremental(FLSystemSymbolBuffer(Base), Config, IncrementalSegments, IncrementalLeaves);
+		const int32 FirstChanged = IncrementalInterp->InterpretSymbolsIncremental(
+			FLSystemSymbolBuffer(Base + TEXT("F[-FL]F")), Config, IncrementalSegments, IncrementalLeaves);
+
+		UTurtleInterpreter* FullInterp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> FullSegments;
+		TArray<FLeafData> FullLeaves;
+		FullInterp->InterpretString(Base + TEXT("F[-FL]F"), Config, FullSegments, FullLeaves);
+
+		bool bIdentical = IncrementalSegments.Num() == FullSegments.Num() && FullSegments.Num() > 0;
+		for (int32 i = 0; bIdentical && i < FullSegments.Num(); ++i)
+		{
+			bIdentical = IncrementalSegments[i].EndPosition == FullSegments[i].EndPosition;
+		}
+
+		bool bPassed = FirstChanged > 0 && bIdentical &&
+		               IncrementalLeaves.Num() == FullLeaves.Num();
+		LogTestResult(TEXT("IncrementalInterpretation"), bPassed,
+		              FString::Printf(TEXT("First changed: %d, Segments: %d vs %d"),
+		                              FirstChanged, IncrementalSegments.Num(), FullSegments.Num()));
+	}
+
+	// Test 10: Struct-of-arrays output matches the Blueprint structs and meshes identically
+	{
+		FTurtleConfig Config;
+		Config.RandomSeed = 31;
+
+		const FLSystemSymbolBuffer Symbols(FString(TEXT("FF[+FL][-F[&FL]]F[^FL]F")));
+
+		UTurtleInterpreter* Interp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> Segments;
+		TArray<FLeafData> Leaves;
+		Interp->InterpretSymbols(Symbols, Config, Segments, Leaves);
+
+		FTreeSkeleton Skeleton;
+		Interp->InterpretSymbolsToSkeleton(Symbols, Config, Skeleton);
+
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+		FTreeMeshData ArrayMesh = Geo->GenerateMesh(Segments, Leaves, 6, true);
+		FTreeMeshData SkeletonMesh = Geo->GenerateMeshFromSkeleton(Skeleton, 6, true);
+
+		bool bPassed = Skeleton.NumSegments() == Segments.Num() &&
+		               Skeleton.NumLeaves() == Leaves.Num() &&
+		               Segments.Num() > 0 &&
+		               Skeleton.ParentIndices.Last() == Segments.Last().ParentSegmentIndex &&
+		               FVector(Skeleton.SegmentEnds.Last()).Equals(Segments.Last().EndPosition, 0.01f) &&
+		               SkeletonMesh.GetVertexCount() == ArrayMesh.GetVertexCount() &&
+		               SkeletonMesh.Branches.Triangles == ArrayMesh.Branches.Triangles;
+		LogTestResult(TEXT("SkeletonOutput"), bPassed,
+		              FString::Printf(TEXT("Segments: %d vs %d, Leaves: %d vs %d"),
+		                              Skeleton.NumSegments(), Segments.Num(), Skeleton.NumLeaves(), Leaves.Num()));
+	}
+
+	// Test 11: A run of rotations about one axis matches a single rotation by the summed angle
+	{
+		FTurtleConfig Config;
+		Config.RandomSeed = 5;
+		Config.AngleVariationMin = 0.0f;
+		Config.AngleVariationMax = 0.0f;
+		Config.PitchVariationMin = 0.0f;
+		Config.PitchVariationMax = 0.0f;
+		Config.StepLengthVariation = 0.0f;
+		Config.TropismStrength = 0.0f;
+		Config.DefaultAngle = 22.5f;
+		Config.PitchAngle = 30.0f;
+
+		FTurtleConfig SingleConfig = Config;
+		SingleConfig.DefaultAngle = 90.0f;
+		SingleConfig.PitchAngle = 60.0f;
+
+		UTurtleInterpreter* Interp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> RunSegments, SingleSegments;
+		TArray<FLeafData> Leaves;
+		Interp->InterpretString(TEXT("++++F&&F"), Config, RunSegments, Leaves);
+		Interp->InterpretString(TEXT("+F&F"), SingleConfig, SingleSegments, Leaves);
+
+		bool bPassed = RunSegments.Num() == 2 && SingleSegments.Num() == 2 &&
+		               RunSegments[0].Direction.Equals(SingleSegments[0].Direction, 0.001f) &&
+		               RunSegments[1].EndPosition.Equals(SingleSegments[1].EndPosition, 0.01f);
+		LogTestResult(TEXT("CollapsedRotationRuns"), bPassed,
+		              FString::Printf(TEXT("Segments: %d vs %d"), RunSegments.Num(), SingleSegments.Num()));
+	}
+
+	// Test 12: Nesting deeper than the inline stack restores every branch and is reported by the generator
+	{
+		FTurtleConfig Config;
+		Config.RandomSeed = 12;
+		Config.BranchProbability = 1.0f;
+
+		FString Deep = TEXT("F");
+		for (int32 i = 0; i < 40; ++i)
+		{
+			Deep += TEXT("[+F");
+		}
+		for (int32 i = 0; i < 40; ++i)
+		{
+			Deep += TEXT("]");
+		}
+		Deep += TEXT("F");
+
+		UTurtleInterpreter* Interp = NewObject<UTurtleInterpreter>(this);
+		TArray<FBranchSegment> Segments;
+		TArray<FLeafData> Leaves;
+		Interp->InterpretString(Deep, Config, Segments, Leaves);
+
+		ULSystemGenerator* Gen = CreateTestGenerator();
+		Gen->Initialize(TEXT("F"));
+		Gen->AddRuleSimple(TEXT("F"), TEXT("F[+F]F"));
+		Gen->Generate(3);
+
+		bool bPassed = Segments.Num() == 42 &&
+		               Interp->GetMaxDepth() == 40 &&
+		               Segments.Last().StartPosition.Equals(Segments[0].EndPosition, 0.01f) &&
+		               Segments.Last().ParentSegmentIndex == 0 &&
+		               Interp->GetCurrentState().Depth == 0 &&
+		               Gen->GetStatistics().MaxBracketDepth == 3;
+		LogTestResult(TEXT("DeepBranchStack"), bPassed,
+		              FString::Printf(TEXT("Segments: %d, MaxDepth: %d, Generator depth: %d"),
+		                              Segments.Num(), Interp->GetMaxDepth(), Gen->GetStatistics().MaxBracketDepth));
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -764,10 +1312,10 @@ bool ATestLSystemGenerator::TestTreeGeometry()
 
 		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, false);
 
-		bool bPassed = MeshData.Vertices.Num() > 0 && MeshData.Triangles.Num() > 0;
+		bool bPassed = MeshData.Branches.Vertices.Num() > 0 && MeshData.Branches.Triangles.Num() > 0;
 		LogTestResult(TEXT("SingleSegmentGeometry"), bPassed,
 		              FString::Printf(TEXT("Verts: %d, Tris: %d"),
-		                             MeshData.Vertices.Num(), MeshData.GetTriangleCount()));
+		                             MeshData.GetVertexCount(), MeshData.GetTriangleCount()));
 	}
 
 	// Test 2: Radial segments affect vertex count
@@ -788,10 +1336,10 @@ bool ATestLSystemGenerator::TestTreeGeometry()
 		FTreeMeshData Mesh4 = Geo->GenerateMesh(Segments, Leaves, 4, false);
 		FTreeMeshData Mesh8 = Geo->GenerateMesh(Segments, Leaves, 8, false);
 
-		bool bPassed = Mesh8.Vertices.Num() > Mesh4.Vertices.Num();
+		bool bPassed = Mesh8.GetVertexCount() > Mesh4.GetVertexCount();
 		LogTestResult(TEXT("RadialSegmentsAffectVerts"), bPassed,
 		              FString::Printf(TEXT("4-seg: %d verts, 8-seg: %d verts"),
-		                             Mesh4.Vertices.Num(), Mesh8.Vertices.Num()));
+		                             Mesh4.GetVertexCount(), Mesh8.GetVertexCount()));
 	}
 
 	// Test 3: Leaf geometry generation
@@ -812,10 +1360,10 @@ bool ATestLSystemGenerator::TestTreeGeometry()
 		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, true);
 
 		// Each leaf is a quad = 4 vertices, 4 triangles (2 front + 2 back)
-		bool bPassed = MeshData.Vertices.Num() >= 4;
+		bool bPassed = MeshData.Leaves.Vertices.Num() >= 4;
 		LogTestResult(TEXT("LeafGeometry"), bPassed,
 		              FString::Printf(TEXT("Verts: %d, Tris: %d"),
-		                             MeshData.Vertices.Num(), MeshData.GetTriangleCount()));
+		                             MeshData.GetVertexCount(), MeshData.GetTriangleCount()));
 	}
 
 	// Test 4: LOD generation
@@ -853,7 +1401,7 @@ bool ATestLSystemGenerator::TestTreeGeometry()
 		TArray<FTreeMeshData> LODs = Geo->GenerateMeshLODs(Segments, Leaves, LODLevels);
 
 		bool bPassed = LODs.Num() == 2 &&
-		               LODs[0].Vertices.Num() > LODs[1].Vertices.Num();
+		               LODs[0].GetVertexCount() > LODs[1].GetVertexCount();
 		LogTestResult(TEXT("LODGeneration"), bPassed,
 		              FString::Printf(TEXT("%d LODs generated"), LODs.Num()));
 	}
@@ -875,10 +1423,404 @@ bool ATestLSystemGenerator::TestTreeGeometry()
 
 		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, false);
 
-		bool bPassed = MeshData.UVs.Num() == MeshData.Vertices.Num();
+		bool bPassed = MeshData.Branches.UVs.Num() == MeshData.Branches.Vertices.Num();
 		LogTestResult(TEXT("UVGeneration"), bPassed,
 		              FString::Printf(TEXT("UVs: %d, Verts: %d"),
-		                             MeshData.UVs.Num(), MeshData.Vertices.Num()));
+		                             MeshData.Branches.UVs.Num(), MeshData.Branches.Vertices.Num()));
+	}
+
+	// Test 6: LODs built in parallel match meshes built one at a time
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Trunk;
+		Trunk.StartPosition = FVector::ZeroVector;
+		Trunk.EndPosition = FVector(0, 0, 100);
+		Trunk.StartRadius = 10.0f;
+		Trunk.EndRadius = 8.0f;
+		Trunk.Direction = FVector::UpVector;
+		Segments.Add(Trunk);
+
+		FBranchSegment Branch;
+		Branch.StartPosition = FVector(0, 0, 100);
+		Branch.EndPosition = FVector(50, 0, 150);
+		Branch.StartRadius = 8.0f;
+		Branch.EndRadius = 4.0f;
+		Branch.Direction = FVector(1, 0, 1).GetSafeNormal();
+		Branch.ParentSegmentIndex = 0;
+		Segments.Add(Branch);
+
+		TArray<FLeafData> Leaves;
+		FLeafData Leaf;
+		Leaf.Position = FVector(50, 0, 150);
+		Leaf.Normal = FVector::UpVector;
+		Leaf.UpDirection = FVector::ForwardVector;
+		Leaves.Add(Leaf);
+
+		TArray<FTreeLODLevel> LODLevels;
+		const int32 RadialCounts[] = { 16, 8, 4 };
+		for (int32 RadialCount : RadialCounts)
+		{
+			FTreeLODLevel LOD;
+			LOD.RadialSegments = RadialCount;
+			LOD.bIncludeLeaves = RadialCount > 4;
+			LODLevels.Add(LOD);
+		}
+
+		TArray<FTreeMeshData> LODs = Geo->GenerateMeshLODs(Segments, Leaves, LODLevels);
+
+		bool bPassed = LODs.Num() == LODLevels.Num();
+		for (int32 i = 0; bPassed && i < LODLevels.Num(); ++i)
+		{
+			FTreeMeshData Single = Geo->GenerateMesh(Segments, Leaves, LODLevels[i].RadialSegments, LODLevels[i].bIncludeLeaves);
+			bPassed = LODs[i].Branches.Vertices == Single.Branches.Vertices &&
+			          LODs[i].Branches.Triangles == Single.Branches.Triangles &&
+			          LODs[i].Leaves.Vertices == Single.Leaves.Vertices;
+		}
+		LogTestResult(TEXT("ParallelLODsMatchSerial"), bPassed,
+		              FString::Printf(TEXT("%d LODs generated"), LODs.Num()));
+	}
+
+	// Test 7: Shared topology reuses parent rings and skips degenerate segments
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Trunk;
+		Trunk.StartPosition = FVector::ZeroVector;
+		Trunk.EndPosition = FVector(0, 0, 100);
+		Trunk.Direction = FVector::UpVector;
+		Segments.Add(Trunk);
+
+		FBranchSegment Child = Trunk;
+		Child.StartPosition = FVector(0, 0, 100);
+		Child.EndPosition = FVector(0, 0, 200);
+		Child.ParentSegmentIndex = 0;
+		Segments.Add(Child);
+
+		FBranchSegment Degenerate = Child;
+		Degenerate.StartPosition = FVector(0, 0, 200);
+		Degenerate.EndPosition = FVector(0, 0, 200);
+		Degenerate.ParentSegmentIndex = 1;
+		Segments.Add(Degenerate);
+
+		FBranchSegment Orphan = Child;
+		Orphan.StartPosition = FVector(0, 0, 200);
+		Orphan.EndPosition = FVector(0, 0, 250);
+		Orphan.ParentSegmentIndex = 2;
+		Segments.Add(Orphan);
+
+		FTreeMeshTopology Topology = Geo->BuildTopology(Segments);
+		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, TArray<FLeafData>(), 6, false);
+
+		bool bPassed = Topology.NumRings == 5 &&
+		               Topology.NumValidSegments == 3 &&
+		               Topology.Segments[1].StartRing == Topology.Segments[0].EndRing &&
+		               !Topology.Segments[2].IsValid() &&
+		               Topology.Segments[3].bEmitsStartRing &&
+		               MeshData.Branches.Vertices.Num() == Topology.NumRings * 6;
+		LogTestResult(TEXT("SharedMeshTopology"), bPassed,
+		              FString::Printf(TEXT("Rings: %d, Verts: %d"), Topology.NumRings, MeshData.Branches.Vertices.Num()));
+	}
+
+	// Test 8: Template rings lie on the cylinder with unit outward normals
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+		Geo->bSmoothNormals = false;
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Seg;
+		Seg.StartPosition = FVector(10, 20, 30);
+		Seg.EndPosition = FVector(110, 20, 130);
+		Seg.StartRadius = 10.0f;
+		Seg.EndRadius = 5.0f;
+		Seg.Direction = (Seg.EndPosition - Seg.StartPosition).GetSafeNormal();
+		Segments.Add(Seg);
+
+		const int32 RadialCount = 7;
+		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, TArray<FLeafData>(), RadialCount, false);
+
+		const FTreeMeshSectionData& Branches = MeshData.Branches;
+
+		bool bPassed = Branches.Vertices.Num() == RadialCount * 2;
+		for (int32 i = 0; bPassed && i < Branches.Vertices.Num(); ++i)
+		{
+			const bool bStartRing = i < RadialCount;
+			const FVector Center = bStartRing ? Seg.StartPosition : Seg.EndPosition;
+			const float Radius = bStartRing ? Seg.StartRadius : Seg.EndRadius;
+			const FVector& Normal = Branches.Normals[i];
+
+			bPassed = FMath::IsNearlyEqual(FVector::Dist(Branches.Vertices[i], Center), Radius, 0.01f) &&
+			          FMath::IsNearlyEqual(Normal.Size(), 1.0f, 0.001f) &&
+			          FMath::IsNearlyZero(FVector::DotProduct(Normal, Seg.Direction), 0.001f);
+		}
+		LogTestResult(TEXT("RingTemplateGeometry"), bPassed);
+	}
+
+	// Test 9: Sections are self-contained and ready for the mesh component
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Seg;
+		Seg.StartPosition = FVector::ZeroVector;
+		Seg.EndPosition = FVector(0, 0, 100);
+		Seg.Direction = FVector::UpVector;
+		Segments.Add(Seg);
+
+		TArray<FLeafData> Leaves;
+		FLeafData Leaf;
+		Leaf.Position = FVector(0, 0, 100);
+		Leaf.Normal = FVector::ForwardVector;
+		Leaf.UpDirection = FVector::UpVector;
+		Leaves.Add(Leaf);
+		Leaves.Add(Leaf);
+
+		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, true);
+
+		bool bPassed = true;
+		for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+		{
+			const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+			const int32 NumVerts = Section.Vertices.Num();
+
+			bPassed &= Section.IsValid() &&
+			           Section.Normals.Num() == NumVerts &&
+			           Section.UVs.Num() == NumVerts &&
+			           Section.VertexColors.Num() == NumVerts &&
+			           Section.Tangents.Num() == NumVerts;
+
+			for (int32 Index : Section.Triangles)
+			{
+				bPassed &= Index >= 0 && Index < NumVerts;
+			}
+		}
+		LogTestResult(TEXT("RenderReadySections"), bPassed,
+		              FString::Printf(TEXT("Branch verts: %d, Leaf verts: %d"),
+		                              MeshData.Branches.GetVertexCount(), MeshData.Leaves.GetVertexCount()));
+	}
+
+	// Test 9b: Flattened mesh data reproduces the pre-section layout and leaf color
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Seg;
+		Seg.StartPosition = FVector::ZeroVector;
+		Seg.EndPosition = FVector(0, 0, 100);
+		Seg.Direction = FVector::UpVector;
+		Segments.Add(Seg);
+
+		TArray<FLeafData> Leaves;
+		FLeafData Leaf;
+		Leaf.Position = FVector(0, 0, 100);
+		Leaf.Normal = FVector::ForwardVector;
+		Leaf.UpDirection = FVector::UpVector;
+		Leaves.Add(Leaf);
+
+		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, true);
+
+		TArray<FVector> Vertices, Normals, Tangents;
+		TArray<int32> Triangles;
+		TArray<FVector2D> UVs;
+		TArray<FLinearColor> Colors;
+		int32 BranchVertexCount = 0;
+		int32 BranchTriangleCount = 0;
+		UTreeGeometry::FlattenMeshData(MeshData, Vertices, Triangles, Normals, UVs, Colors, Tangents,
+		                               BranchVertexCount, BranchTriangleCount);
+
+		// Baseline leaf vertex color: linear (0.2, 0.6, 0.2) quantized without sRGB conversion
+		const FColor ExpectedLeafColor(51, 153, 51, 255);
+		const FColor LeafColor = MeshData.Leaves.VertexColors.Num() > 0 ? MeshData.Leaves.VertexColors[0] : FColor::Black;
+
+		bool bLayout = Vertices.Num() == MeshData.GetVertexCount() &&
+		               Triangles.Num() == MeshData.GetTriangleCount() * 3 &&
+		               Colors.Num() == Vertices.Num() && Tangents.Num() == Vertices.Num() &&
+		               BranchVertexCount == MeshData.Branches.GetVertexCount() &&
+		               BranchTriangleCount == MeshData.Branches.GetTriangleCount();
+
+		// The first leaf triangle indexes past the branch vertices
+		bool bOffset = Triangles.IsValidIndex(BranchTriangleCount * 3) &&
+		               Triangles[BranchTriangleCount * 3] >= BranchVertexCount;
+
+		bool bPassed = bLayout && bOffset && LeafColor == ExpectedLeafColor;
+		LogTestResult(TEXT("FlattenMeshData"), bPassed,
+		              FString::Printf(TEXT("Verts: %d, Branch verts: %d, Leaf color: %s"),
+		                              Vertices.Num(), BranchVertexCount, *LeafColor.ToString()));
+	}
+
+	// Test 10: Baked mesh description mirrors the procedural sections
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		TArray<FBranchSegment> Segments;
+		FBranchSegment Seg;
+		Seg.StartPosition = FVector::ZeroVector;
+		Seg.EndPosition = FVector(0, 0, 100);
+		Seg.Direction = FVector::UpVector;
+		Segments.Add(Seg);
+
+		TArray<FLeafData> Leaves;
+		FLeafData Leaf;
+		Leaf.Position = FVector(0, 0, 100);
+		Leaf.Normal = FVector::ForwardVector;
+		Leaf.UpDirection = FVector::UpVector;
+		Leaves.Add(Leaf);
+
+		FTreeMeshData MeshData = Geo->GenerateMesh(Segments, Leaves, 8, true);
+
+		FMeshDescription MeshDescription;
+		UTreeMeshBaker::BuildMeshDescription(MeshData, MeshDescription);
+
+		bool bPassed = MeshDescription.Vertices().Num() == MeshData.GetVertexCount() &&
+		               MeshDescription.Triangles().Num() == MeshData.GetTriangleCount() &&
+		               MeshDescription.PolygonGroups().Num() == FTreeMeshData::NumSections;
+		LogTestResult(TEXT("BakeMeshDescription"), bPassed,
+		              FString::Printf(TEXT("Verts: %d, Tris: %d"),
+		                              MeshDescription.Vertices().Num(), MeshDescription.Triangles().Num()));
+	}
+
+	// Test 11: Leaf instance transforms place a unit card exactly over the leaf quad
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		FTreeSkeleton Skeleton;
+		Skeleton.AddLeaf(FVector(10, 20, 100), FVector::ForwardVector, FVector::UpVector, FVector2D(10.0f, 15.0f), 20.0f, 2);
+
+		TArray<FTransform> Transforms;
+		Geo->BuildLeafInstanceTransforms(Skeleton, FVector2D(1.0f, 1.0f), Transforms);
+		FTreeMeshData MeshData = Geo->GenerateMeshFromSkeleton(Skeleton, 8, true);
+
+		// Card corner at +half height (X) and +half width (Y) is the quad's top-right vertex
+		bool bPassed = Transforms.Num() == 1 &&
+		               MeshData.Leaves.Vertices.Num() >= 4 &&
+		               Transforms[0].TransformPosition(FVector(0.5f, 0.5f, 0.0f)).Equals(MeshData.Leaves.Vertices[2], 0.01f) &&
+		               Transforms[0].TransformVector(FVector::UpVector).GetSafeNormal().Equals(FVector::ForwardVector, 0.001f);
+		LogTestResult(TEXT("LeafInstanceTransforms"), bPassed,
+		              FString::Printf(TEXT("Instances: %d"), Transforms.Num()));
+	}
+
+	// Test 12: Simplification merges straight chains and replaces thin twigs with cards
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		// Straight trunk of 20 segments with a thin two-segment twig halfway up
+		FTreeSkeleton Skeleton;
+		int32 Parent = INDEX_NONE;
+		for (int32 i = 0; i < 20; ++i)
+		{
+			Parent = Skeleton.AddSegment(FVector(0, 0, i * 10.0f), FVector(0, 0, (i + 1) * 10.0f), FVector::UpVector,
+			                             5.0f, 5.0f, 0, Parent);
+			if (i == 9)
+			{
+				const int32 Twig = Skeleton.AddSegment(FVector(0, 0, 100), FVector(10, 0, 110), FVector(1, 0, 1).GetSafeNormal(),
+				                                       0.5f, 0.4f, 1, Parent);
+				Skeleton.AddSegment(FVector(10, 0, 110), FVector(20, 0, 120), FVector(1, 0, 1).GetSafeNormal(), 0.4f, 0.3f, 1, Twig);
+			}
+		}
+
+		FTreeLODLevel LOD(4, 0.1f, false);
+		LOD.MergeAngleThreshold = 5.0f;
+		LOD.MinBranchRadius = 1.0f;
+		LOD.bReplacePrunedWithCards = true;
+
+		FTreeSkeleton Simplified;
+		FTreeSimplifier::Simplify(Skeleton, LOD, Simplified);
+
+		TArray<FTreeLODLevel> LODLevels;
+		LODLevels.Add(FTreeLODLevel(4, 1.0f, false));
+		LODLevels.Add(LOD);
+		TArray<FTreeMeshData> LODs = Geo->GenerateMeshLODsFromSkeleton(Skeleton, LODLevels);
+
+		bool bPassed = Simplified.NumSegments() == 1 &&
+		               Simplified.NumLeaves() == 1 &&
+		               FVector(Simplified.SegmentEnds[0]).Equals(FVector(0, 0, 200), 0.01f) &&
+		               Simplified.ParentIndices[0] == INDEX_NONE &&
+		               LODs.Num() == 2 &&
+		               LODs[1].Branches.Triangles.Num() * 10 < LODs[0].Branches.Triangles.Num();
+		LogTestResult(TEXT("SkeletonSimplification"), bPassed,
+		              FString::Printf(TEXT("Segments: %d -> %d, Cards: %d, Tris: %d -> %d"),
+		                              Skeleton.NumSegments(), Simplified.NumSegments(), Simplified.NumLeaves(),
+		                              LODs.Num() == 2 ? LODs[0].GetTriangleCount() : 0,
+		                              LODs.Num() == 2 ? LODs[1].GetTriangleCount() : 0));
+	}
+
+	// Test 13: Tangents follow U around the ring and smoothed normals lean with the taper
+	{
+		UTreeGeometry* Geo = NewObject<UTreeGeometry>(this);
+
+		FTreeSkeleton Skeleton;
+		Skeleton.AddSegment(FVector::ZeroVector, FVector(0, 0, 100), FVector::UpVector, 10.0f, 5.0f, 0, INDEX_NONE);
+		Skeleton.AddLeaf(FVector(0, 0, 100), FVector::ForwardVector, FVector::UpVector, FVector2D::ZeroVector, 20.0f, 0);
+
+		const int32 RadialCount = 8;
+		FTreeMeshData MeshData = Geo->GenerateMeshFromSkeleton(Skeleton, RadialCount, true);
+		const FTreeMeshSectionData& Branches = MeshData.Branches;
+
+		// Cone slope (10 - 5) / 100 tilts every normal towards the thin end
+		const float ExpectedLean = 0.05f / FMath::Sqrt(1.0f + 0.05f * 0.05f);
+
+		bool bPassed = Branches.Tangents.Num() == Branches.Vertices.Num() &&
+		               MeshData.Leaves.Tangents.Num() == MeshData.Leaves.Vertices.Num();
+		for (int32 i = 0; bPassed && i < Branches.Vertices.Num(); ++i)
+		{
+			const FVector& Normal = Branches.Normals[i];
+			const FVector& Tangent = Branches.Tangents[i].TangentX;
+			const int32 Next = (i % RadialCount == RadialCount - 1) ? i + 1 - RadialCount : i + 1;
+
+			bPassed = FMath::IsNearlyEqual(Normal.Size(), 1.0f, 0.001f) &&
+			          FMath::IsNearlyEqual(Normal.Z, ExpectedLean, 0.001f) &&
+			          FMath::IsNearlyEqual(Tangent.Size(), 1.0f, 0.001f) &&
+			          FMath::IsNearlyZero(FVector::DotProduct(Normal, Tangent), 0.001f) &&
+			          FMath::IsNearlyZero(Tangent.Z, 0.001f) &&
+			          FVector::DotProduct(Tangent, Branches.Vertices[Next] - Branches.Vertices[i]) > 0.0f;
+		}
+		for (int32 i = 0; bPassed && i < MeshData.Leaves.Vertices.Num(); ++i)
+		{
+			bPassed = FMath::IsNearlyZero(FVector::DotProduct(MeshData.Leaves.Tangents[i].TangentX, MeshData.Leaves.Normals[i]), 0.001f);
+		}
+		LogTestResult(TEXT("AnalyticTangents"), bPassed,
+		              FString::Printf(TEXT("Branch verts: %d, Leaf verts: %d"),
+		                              Branches.GetVertexCount(), MeshData.Leaves.GetVertexCount()));
+	}
+
+	// Test 14: Collision capsules merge straight chains and skip deep or thin branches
+	{
+		// Straight 10-segment trunk, a first-order branch of 3 bent segments and a thin second-order twig
+		FTreeSkeleton Skeleton;
+		int32 Parent = INDEX_NONE;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			Parent = Skeleton.AddSegment(FVector(0, 0, i * 20.0f), FVector(0, 0, (i + 1) * 20.0f), FVector::UpVector,
+			                             10.0f, 10.0f, 0, Parent);
+		}
+		const FVector BranchDirection = FVector(1, 0, 1).GetSafeNormal();
+		int32 Branch = 4;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const FVector Start = FVector(0, 0, 100) + BranchDirection * (i * 20.0f);
+			Branch = Skeleton.AddSegment(Start, Start + BranchDirection * 20.0f, BranchDirection, 4.0f, 4.0f, 1, Branch);
+		}
+		Skeleton.AddSegment(FVector(0, 0, 150), FVector(0, 20, 170), FVector(0, 1, 1).GetSafeNormal(), 3.0f, 3.0f, 2, 7);
+		Skeleton.AddSegment(FVector(0, 0, 160), FVector(20, 20, 160), FVector(1, 1, 0).GetSafeNormal(), 1.0f, 1.0f, 1, 7);
+
+		TArray<FKSphylElem> Capsules;
+		UTreeGeometry::BuildCollisionCapsules(Skeleton, 1, 2.0f, 0, Capsules);
+
+		TArray<FKSphylElem> Limited;
+		UTreeGeometry::BuildCollisionCapsules(Skeleton, 1, 2.0f, 1, Limited);
+
+		bool bPassed = Capsules.Num() == 2 &&
+		               FMath::IsNearlyEqual(Capsules[0].Radius, 10.0f, 0.01f) &&
+		               FMath::IsNearlyEqual(Capsules[0].Length, 200.0f, 0.01f) &&
+		               Capsules[0].Center.Equals(FVector(0, 0, 100), 0.01f) &&
+		               FMath::IsNearlyEqual(Capsules[1].Length, 60.0f, 0.01f) &&
+		               Capsules[1].Rotation.RotateVector(FVector::UpVector).Equals(BranchDirection, 0.001f) &&
+		               Limited.Num() == 1 &&
+		               FMath::IsNearlyEqual(Limited[0].Radius, 10.0f, 0.01f);
+		LogTestResult(TEXT("CollisionCapsules"), bPassed,
+		              FString::Printf(TEXT("Segments: %d, Capsules: %d"), Skeleton.NumSegments(), Capsules.Num()));
 	}
 
 	return FailedTests == InitialFailed;
@@ -991,6 +1933,79 @@ bool ATestLSystemGenerator::TestTreeMath()
 		              FString::Printf(TEXT("Points: %d"), Points.Num()));
 	}
 
+	// Test 8: Screen-size driven LOD selection
+	{
+		TArray<FTreeLODLevel> LODs;
+		LODs.Add(FTreeLODLevel(8, 1.0f));
+		LODs.Add(FTreeLODLevel(6, 0.5f));
+		LODs.Add(FTreeLODLevel(4, 0.25f, false));
+
+		const float Near = UTreeMath::ComputeScreenSize(100.0f, 100.0f);
+		const float Far = UTreeMath::ComputeScreenSize(100.0f, 1000.0f);
+		bool bMonotonic = Near > Far;
+
+		bool bPicks = UTreeMath::SelectLODForScreenSize(LODs, 0.8f) == 0 &&
+		              UTreeMath::SelectLODForScreenSize(LODs, 0.3f) == 1 &&
+		              UTreeMath::SelectLODForScreenSize(LODs, 0.1f) == 2;
+
+		bool bPassed = bMonotonic && bPicks;
+		LogTestResult(TEXT("SelectLODForScreenSize"), bPassed,
+		              FString::Printf(TEXT("Near: %.3f, Far: %.3f"), Near, Far));
+	}
+
+	// Test 9: Debug draw decimation keeps shallow depths first
+	{
+		TArray<int32> SegmentsPerDepth = { 10, 40, 200, 1000 };
+
+		int32 UnlimitedStride = 0;
+		const int32 UnlimitedDepths = UTreeDebugDraw::GetDecimationDepth(SegmentsPerDepth, 1, 0, UnlimitedStride);
+
+		// 100 lines: depths 0-1 fit (50), depth 2 strided to at most the 50 left
+		int32 Stride = 0;
+		const int32 FullDepths = UTreeDebugDraw::GetDecimationDepth(SegmentsPerDepth, 1, 100, Stride);
+		const int32 StridedCount = Stride > 0 ? FMath::DivideAndRoundUp(SegmentsPerDepth[2], Stride) : 0;
+
+		// Budget smaller than the trunk: the trunk itself is strided
+		int32 TrunkStride = 0;
+		const int32 TrunkDepths = UTreeDebugDraw::GetDecimationDepth(SegmentsPerDepth, 2, 10, TrunkStride);
+
+		bool bPassed = UnlimitedDepths == SegmentsPerDepth.Num() && UnlimitedStride == 1 &&
+		               FullDepths == 2 && StridedCount <= 50 && StridedCount > 0 &&
+		               TrunkDepths == 0 && TrunkStride == 2;
+		LogTestResult(TEXT("DebugDrawDecimation"), bPassed,
+		              FString::Printf(TEXT("FullDepths: %d, Stride: %d, Strided: %d, TrunkStride: %d"),
+		                              FullDepths, Stride, StridedCount, TrunkStride));
+	}
+
+	// Test 10: Scratch buffers come back empty with their capacity, nested borrows are distinct, trims free them
+	{
+		const int32* FirstData = nullptr;
+		{
+			TTreeScratch<TArray<int32>> Scratch;
+			Scratch->SetNumZeroed(1000);
+			FirstData = Scratch->GetData();
+		}
+
+		bool bReused = false;
+		int32 ReusedCapacity = 0;
+		const bool bRetained = FTreeScratchSettings::GetMaxRetainedBytes() > 0;
+		{
+			TTreeScratch<TArray<int32>> Reused;
+			TTreeScratch<TArray<int32>> Nested;
+			ReusedCapacity = Reused->Max();
+			bReused = Reused->Num() == 0 && &Reused.Get() != &Nested.Get() &&
+			          (!bRetained || (Reused->GetData() == FirstData && ReusedCapacity >= 1000));
+		}
+
+		FTreeScratchSettings::Trim();
+		TTreeScratch<TArray<int32>> Trimmed;
+
+		bool bPassed = bReused && Trimmed->Max() == 0;
+		LogTestResult(TEXT("ScratchReuse"), bPassed,
+		              FString::Printf(TEXT("Retained: %s, Capacity: %d, After trim: %d"),
+		                              bRetained ? TEXT("true") : TEXT("false"), ReusedCapacity, Trimmed->Max()));
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -1057,16 +2072,186 @@ bool ATestLSystemGenerator::TestFullPipeline()
 
 		TArray<FTreeMeshData> LODs = Geo->GenerateMeshLODs(Segments, Leaves, LODLevels);
 
-		bool bGeoOk = LODs.Num() > 0 && LODs[0].Vertices.Num() > 0;
+		bool bGeoOk = LODs.Num() > 0 && LODs[0].GetVertexCount() > 0;
 		LogTestResult(TEXT("FullPipeline_Geometry"), bGeoOk,
 		              FString::Printf(TEXT("Vertices: %d, Triangles: %d"),
-		                             LODs[0].Vertices.Num(), LODs[0].GetTriangleCount()));
+		                             LODs[0].GetVertexCount(), LODs[0].GetTriangleCount()));
 
 		// Overall pipeline success
 		bool bPassed = GenResult.bSuccess && bInterpOk && bGeoOk;
 		LogTestResult(TEXT("FullPipeline_Complete"), bPassed);
 	}
 
+#if WITH_EDITOR
+	// Test: Editing a field nested inside a component struct regenerates only the stages it affects
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 4;
+		Tree->bRandomizeSeed = false;
+		Tree->bUseGenerationCache = false;
+		Tree->GenerateTree();
+
+		const FTreeGeneratedDataPtr Before = Tree->CachedData;
+
+		// What the details panel reports for GeometryConfig.BarkUVTiling
+		Tree->GeometryConfig.BarkUVTiling *= 2.0f;
+		FPropertyChangedEvent GeometryEvent(FindFProperty<FProperty>(FTreeGeometryConfig::StaticStruct(),
+			GET_MEMBER_NAME_CHECKED(FTreeGeometryConfig, BarkUVTiling)));
+		GeometryEvent.SetActiveMemberProperty(FindFProperty<FProperty>(UProceduralTreeComponent::StaticClass(),
+			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, GeometryConfig)));
+		Tree->PostEditChangeProperty(GeometryEvent);
+
+		// Geometry only: symbols and skeleton are carried over
+		const FTreeGenerationBreakdown GeometryEdit = Tree->GetLastGenerationBreakdown();
+		const bool bGeometryOnly = Tree->CachedData != Before && Tree->GetVertexCount() > 0 && !GeometryEdit.bFromCache &&
+		                           GeometryEdit.LSystemTimeMs == 0.0f && GeometryEdit.TurtleTimeMs == 0.0f;
+
+		// TurtleConfig.DefaultAngle reruns the turtle but keeps the symbols
+		Tree->TurtleConfig.DefaultAngle += 5.0f;
+		FPropertyChangedEvent TurtleEvent(FindFProperty<FProperty>(FTurtleConfig::StaticStruct(),
+			GET_MEMBER_NAME_CHECKED(FTurtleConfig, DefaultAngle)));
+		TurtleEvent.SetActiveMemberProperty(FindFProperty<FProperty>(UProceduralTreeComponent::StaticClass(),
+			GET_MEMBER_NAME_CHECKED(UProceduralTreeComponent, TurtleConfig)));
+		Tree->PostEditChangeProperty(TurtleEvent);
+
+		const FTreeGenerationBreakdown TurtleEdit = Tree->GetLastGenerationBreakdown();
+		const bool bTurtleAndGeometry = !TurtleEdit.bFromCache && TurtleEdit.LSystemTimeMs == 0.0f && TurtleEdit.TurtleTimeMs > 0.0f;
+
+		bool bPassed = bGeometryOnly && bTurtleAndGeometry;
+		LogTestResult(TEXT("NestedPropertyEditRegenerates"), bPassed,
+		              FString::Printf(TEXT("UV edit L-System/Turtle: %.3f/%.3f ms, Angle edit L-System/Turtle: %.3f/%.3f ms"),
+		                              GeometryEdit.LSystemTimeMs, GeometryEdit.TurtleTimeMs,
+		                              TurtleEdit.LSystemTimeMs, TurtleEdit.TurtleTimeMs));
+		Tree->DestroyComponent();
+	}
+#endif
+
+	// Test: A manual LOD choice turns off automatic LOD selection
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 2;
+		Tree->bRandomizeSeed = false;
+		Tree->bUseGenerationCache = false;
+		Tree->GenerateTree();
+
+		bool bDefaultOff = !Tree->bAutoLOD;
+
+		Tree->SetAutoLOD(true);
+		Tree->SetLODLevel(1);
+
+		bool bPassed = bDefaultOff && Tree->GetLODCount() > 1 &&
+		               !Tree->bAutoLOD && Tree->GetCurrentLODLevel() == 1;
+		LogTestResult(TEXT("ManualLODDisablesAutoLOD"), bPassed,
+		              FString::Printf(TEXT("LODs: %d, Current: %d, AutoLOD: %s"),
+		                              Tree->GetLODCount(), Tree->GetCurrentLODLevel(),
+		                              Tree->bAutoLOD ? TEXT("On") : TEXT("Off")));
+		Tree->DestroyComponent();
+	}
+
+	// Test: Clearing a tree releases its data, not just the mesh sections
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 2;
+		Tree->bRandomizeSeed = false;
+		Tree->bUseGenerationCache = false;
+		Tree->GenerateTree();
+
+		const int32 GeneratedLODs = Tree->GetLODCount();
+		Tree->ClearTree();
+
+		const FTreeGenerationBreakdown Breakdown = Tree->GetLastGenerationBreakdown();
+		bool bPassed = GeneratedLODs > 0 && Tree->GetLODCount() == 0 && Tree->GetVertexCount() == 0 &&
+		               Tree->GetLeafCount() == 0 && Tree->GetLSystemString().IsEmpty() &&
+		               Breakdown.SymbolBytes == 0 && Breakdown.SkeletonBytes == 0 && Breakdown.MeshBytes == 0;
+		LogTestResult(TEXT("ClearTreeReleasesData"), bPassed,
+		              FString::Printf(TEXT("LODs before: %d, after: %d, Vertices: %d"),
+		                              GeneratedLODs, Tree->GetLODCount(), Tree->GetVertexCount()));
+		Tree->DestroyComponent();
+	}
+
+	// Test: Collision mode edits on an unchanged tree reuse its data and recreate the LOD 0 collision
+	{
+		UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+		Tree->Iterations = 2;
+		Tree->bRandomizeSeed = false;
+		Tree->bUseGenerationCache = false;
+		Tree->GeometryConfig.bGenerateCollision = true;
+		Tree->GeometryConfig.CollisionMode = ETreeCollisionMode::Triangles;
+		Tree->GenerateTree();
+
+		const FTreeGeneratedDataPtr Generated = Tree->CachedData;
+		auto HasTriangleCollision = [Tree]()
+		{
+			const FProcMeshSection* Section = Tree->GetProcMeshSection(FTreeMeshData::BranchSectionIndex);
+			return Section && Section->bEnableCollision;
+		};
+
+		const bool bTriangles = HasTriangleCollision();
+
+		Tree->GeometryConfig.bGenerateCollision = false;
+		Tree->GenerateTree();
+		const bool bNone = !HasTriangleCollision();
+
+		Tree->GeometryConfig.bGenerateCollision = true;
+		Tree->GeometryConfig.CollisionMode = ETreeCollisionMode::Capsules;
+		Tree->GenerateTree();
+		const bool bCapsules = !HasTriangleCollision();
+
+		Tree->GeometryConfig.CollisionMode = ETreeCollisionMode::Triangles;
+		Tree->GenerateTree();
+		const bool bTrianglesAgain = HasTriangleCollision();
+
+		bool bPassed = bTriangles && bNone && bCapsules && bTrianglesAgain && Tree->CachedData == Generated;
+		LogTestResult(TEXT("CollisionModeToggle"), bPassed,
+		              FString::Printf(TEXT("Triangles: %s, None: %s, Capsules: %s, Triangles again: %s, Data reused: %s"),
+		                              bTriangles ? TEXT("Yes") : TEXT("No"), bNone ? TEXT("Yes") : TEXT("No"),
+		                              bCapsules ? TEXT("Yes") : TEXT("No"), bTrianglesAgain ? TEXT("Yes") : TEXT("No"),
+		                              Tree->CachedData == Generated ? TEXT("Yes") : TEXT("No")));
+		Tree->DestroyComponent();
+	}
+
+	// Test: Scheduled trees with identical inputs share one pipeline, cancelling it requeues the others
+	if (UTreeGenerationSubsystem* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UTreeGenerationSubsystem>() : nullptr)
+	{
+		auto MakeScheduledTree = [this]()
+		{
+			UProceduralTreeComponent* Tree = NewObject<UProceduralTreeComponent>(this);
+			Tree->Iterations = 2;
+			Tree->bRandomizeSeed = false;
+			Tree->bUseGenerationCache = false;
+			return Tree;
+		};
+
+		UProceduralTreeComponent* Leader = MakeScheduledTree();
+		UProceduralTreeComponent* Follower = MakeScheduledTree();
+		Scheduler->EnqueueTree(Leader);
+		Scheduler->EnqueueTree(Follower);
+		Scheduler->Tick(0.0f);
+
+		// Only the leader runs a pipeline (IsGeneratingTree also counts queued trees); the follower waits for its result
+		bool bDeduplicated = Leader->ActiveGeneration.IsValid() && !Follower->ActiveGeneration.IsValid() &&
+		                     Scheduler->IsTreeScheduled(Follower);
+		LogTestResult(TEXT("SchedulerFollowerDedup"), bDeduplicated,
+		              FString::Printf(TEXT("Leader running: %s, Follower running: %s"),
+		                              Leader->ActiveGeneration.IsValid() ? TEXT("Yes") : TEXT("No"),
+		                              Follower->ActiveGeneration.IsValid() ? TEXT("Yes") : TEXT("No")));
+
+		Leader->CancelTreeGeneration();
+		bool bRequeued = !Scheduler->IsTreeScheduled(Leader) && Scheduler->IsTreeScheduled(Follower) &&
+		                 !Follower->ActiveGeneration.IsValid();
+		Scheduler->Tick(0.0f);
+
+		bool bPassed = bRequeued && Follower->ActiveGeneration.IsValid();
+		LogTestResult(TEXT("SchedulerLeaderCancelRequeues"), bPassed,
+		              FString::Printf(TEXT("Requeued: %s, Follower running: %s"),
+		                              bRequeued ? TEXT("Yes") : TEXT("No"),
+		                              Follower->ActiveGeneration.IsValid() ? TEXT("Yes") : TEXT("No")));
+
+		Follower->CancelTreeGeneration();
+		Leader->DestroyComponent();
+		Follower->DestroyComponent();
+	}
+
 	return FailedTests == InitialFailed;
 }
 
@@ -1115,3 +2300,8 @@ void ATestLSystemGenerator::ResetTestCounters()
 	FailedTests = 0;
 	TotalTestTimeMs = 0.0f;
 }
+
+void ATestLSystemGenerator::HandleTreeGenerated(bool bSuccess)
+{
+	TreeGeneratedCount++;
+}
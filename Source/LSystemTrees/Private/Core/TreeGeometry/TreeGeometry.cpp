@@ -3,10 +3,106 @@
 // Part of LSystemTrees Plugin - Phase 3
 
 #include "Core/TreeGeometry/TreeGeometry.h"
+#include "Core/TreeGeometry/TreeSimplifier.h"
 #include "Core/Utilities/TreeMath.h"
+#include "Core/Utilities/TreeScratch.h"
+#include "Core/Utilities/TreeStats.h"
+#include "Async/ParallelFor.h"
+#include "PhysicsEngine/SphylElem.h"
 
 DEFINE_LOG_CATEGORY(LogTreeGeometry);
 
+// ============================================================================
+// Ring Templates
+// ============================================================================
+
+/** Largest supported ring resolution (radial segments are clamped to [3, 32]) */
+static constexpr int32 MaxRingSegments = 32;
+
+/** Unit-circle samples and U coordinates for one ring resolution */
+struct FTreeRingTemplate
+{
+	float Cos[MaxRingSegments];
+	float Sin[MaxRingSegments];
+	float U[MaxRingSegments];
+};
+
+/**
+ * Get the cached unit-circle template for a ring resolution.
+ * The angle set only depends on the segment count, so it is computed once per process.
+ */
+static const FTreeRingTemplate& GetRingTemplate(int32 NumSegments)
+{
+	// Thread-safe static initialization - LODs are built concurrently
+	static const TArray<FTreeRingTemplate> Templates = []()
+	{
+		TArray<FTreeRingTemplate> Result;
+		Result.AddZeroed(MaxRingSegments + 1);
+
+		for (int32 Count = 1; Count <= MaxRingSegments; ++Count)
+		{
+			FTreeRingTemplate& Template = Result[Count];
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const float AngleRad = 2.0f * PI * static_cast<float>(i) / static_cast<float>(Count);
+				Template.Cos[i] = FMath::Cos(AngleRad);
+				Template.Sin[i] = FMath::Sin(AngleRad);
+				Template.U[i] = static_cast<float>(i) / static_cast<float>(Count);
+			}
+		}
+		return Result;
+	}();
+
+	return Templates[FMath::Clamp(NumSegments, 1, MaxRingSegments)];
+}
+
+// ============================================================================
+// FTreeMeshTopology
+// ============================================================================
+
+void FTreeMeshTopology::Build(const FTreeSkeleton& Skeleton, float BarkUVTiling)
+{
+	const int32 NumSegments = Skeleton.NumSegments();
+	Segments.Reset(NumSegments);
+	Segments.AddDefaulted(NumSegments);
+	NumRings = 0;
+	NumValidSegments = 0;
+
+	float VCoordinate = 0.0f;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		FTreeSegmentTopology& Entry = Segments[SegmentIndex];
+
+		const float SegmentLength = Skeleton.GetSegmentLength(SegmentIndex);
+		if (SegmentLength < KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		// Calculate UV V coordinates
+		Entry.StartV = VCoordinate;
+		Entry.EndV = VCoordinate + (SegmentLength * BarkUVTiling / 100.0f);
+		VCoordinate = Entry.EndV;
+
+		// Reuse the parent's end ring if the parent was already emitted
+		const int32 ParentIndex = Skeleton.ParentIndices[SegmentIndex];
+		if (ParentIndex >= 0 && ParentIndex < SegmentIndex && Segments[ParentIndex].IsValid())
+		{
+			Entry.StartRing = Segments[ParentIndex].EndRing;
+			Entry.bEmitsStartRing = false;
+		}
+		else
+		{
+			Entry.StartRing = NumRings++;
+			Entry.bEmitsStartRing = true;
+		}
+
+		Entry.EndRing = NumRings++;
+		++NumValidSegments;
+	}
+}
+
 // ============================================================================
 // Constructor
 // ============================================================================
@@ -14,9 +110,8 @@ DEFINE_LOG_CATEGORY(LogTreeGeometry);
 UTreeGeometry::UTreeGeometry()
 	: BarkUVTiling(1.0f)
 	, DefaultLeafSize(10.0f, 15.0f)
-	, CurrentVCoordinate(0.0f)
+	, bSmoothNormals(true)
 {
-	RandomStream.Initialize(FMath::Rand());
 }
 
 // ============================================================================
@@ -27,29 +122,59 @@ TArray<FTreeMeshData> UTreeGeometry::GenerateMeshLODs(const TArray<FBranchSegmen
                                                        const TArray<FLeafData>& Leaves,
                                                        const TArray<FTreeLODLevel>& LODLevels)
 {
+	FTreeSkeleton Skeleton;
+	Skeleton.FromArrays(Segments, Leaves);
+	return GenerateMeshLODsFromSkeleton(Skeleton, LODLevels);
+}
+
+TArray<FTreeMeshData> UTreeGeometry::GenerateMeshLODsFromSkeleton(const FTreeSkeleton& Skeleton,
+                                                                  const TArray<FTreeLODLevel>& LODLevels)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::GenerateMeshLODs);
+
 	TArray<FTreeMeshData> Results;
 
 	if (LODLevels.Num() == 0)
 	{
 		UE_LOG(LogTreeGeometry, Warning, TEXT("No LOD levels specified, using default"));
-		Results.Add(GenerateMesh(Segments, Leaves, 8, true));
+		Results.Add(GenerateMeshFromSkeleton(Skeleton, 8, true));
 		return Results;
 	}
 
-	Results.Reserve(LODLevels.Num());
+	// Connectivity is the same for every unsimplified LOD, so it is resolved once up front
+	TTreeScratch<FTreeMeshTopology> Topology;
+	Topology->Build(Skeleton, BarkUVTiling);
 
-	for (int32 i = 0; i < LODLevels.Num(); ++i)
+	// Each LOD has its own build context, so they are independent and can run on separate workers
+	Results.SetNum(LODLevels.Num());
+
+	ParallelFor(LODLevels.Num(), [&](int32 i)
 	{
 		const FTreeLODLevel& LOD = LODLevels[i];
 
-		UE_LOG(LogTreeGeometry, Log, TEXT("Generating LOD %d: %d radial segments, leaves=%s"),
-		       i, LOD.RadialSegments, LOD.bIncludeLeaves ? TEXT("true") : TEXT("false"));
-
-		FTreeMeshData MeshData = GenerateMesh(Segments, Leaves, LOD.RadialSegments, LOD.bIncludeLeaves);
-		Results.Add(MeshData);
+		FTreeMeshBuildContext Context;
+		if (LOD.HasSimplification())
+		{
+			// Simplified LODs have their own skeleton (leaves already filtered, cards appended),
+			// both borrowed from the worker's scratch pool
+			TTreeScratch<FTreeSkeleton> Simplified;
+			TTreeScratch<FTreeMeshTopology> SimplifiedTopology;
+			FTreeSimplifier::Simplify(Skeleton, LOD, *Simplified);
+			SimplifiedTopology->Build(*Simplified, BarkUVTiling);
+			BuildMesh(Context, *SimplifiedTopology, *Simplified, LOD.RadialSegments, true);
+		}
+		else
+		{
+			BuildMesh(Context, *Topology, Skeleton, LOD.RadialSegments, LOD.bIncludeLeaves);
+		}
+		Results[i] = MoveTemp(Context.MeshData);
+	});
 
-		UE_LOG(LogTreeGeometry, Log, TEXT("LOD %d: %d vertices, %d triangles"),
-		       i, MeshData.GetVertexCount(), MeshData.GetTriangleCount());
+	for (int32 i = 0; i < LODLevels.Num(); ++i)
+	{
+		UE_LOG(LogTreeGeometry, Log, TEXT("LOD %d: %d radial segments, leaves=%s, %d vertices, %d triangles"),
+		       i, LODLevels[i].RadialSegments, LODLevels[i].bIncludeLeaves ? TEXT("true") : TEXT("false"),
+		       Results[i].GetVertexCount(), Results[i].GetTriangleCount());
 	}
 
 	return Results;
@@ -60,62 +185,147 @@ FTreeMeshData UTreeGeometry::GenerateMesh(const TArray<FBranchSegment>& Segments
                                            int32 RadialSegments,
                                            bool bIncludeLeaves)
 {
-	ResetMeshData();
+	FTreeSkeleton Skeleton;
+	Skeleton.FromArrays(Segments, Leaves);
+	return GenerateMeshFromSkeleton(Skeleton, RadialSegments, bIncludeLeaves);
+}
 
-	// Clamp radial segments
-	RadialSegments = FMath::Clamp(RadialSegments, 3, 32);
-	CurrentRadialSegments = RadialSegments;
+FTreeMeshData UTreeGeometry::GenerateMeshFromSkeleton(const FTreeSkeleton& Skeleton, int32 RadialSegments, bool bIncludeLeaves)
+{
+	FTreeMeshBuildContext Context;
+	BuildMesh(Context, BuildTopology(Skeleton), Skeleton, RadialSegments, bIncludeLeaves);
+	return MoveTemp(Context.MeshData);
+}
+
+FTreeMeshTopology UTreeGeometry::BuildTopology(const TArray<FBranchSegment>& Segments) const
+{
+	FTreeSkeleton Skeleton;
+	Skeleton.FromArrays(Segments, TArray<FLeafData>());
+	return BuildTopology(Skeleton);
+}
 
-	// Clear segment tracking
-	SegmentEndRingIndices.Empty();
+FTreeMeshTopology UTreeGeometry::BuildTopology(const FTreeSkeleton& Skeleton) const
+{
+	FTreeMeshTopology Topology;
+	Topology.Build(Skeleton, BarkUVTiling);
+	return Topology;
+}
+
+// ============================================================================
+// Compatibility
+// ============================================================================
 
-	// Estimate capacity
-	const int32 EstimatedBranchVertices = Segments.Num() * RadialSegments * 2;
-	const int32 EstimatedLeafVertices = bIncludeLeaves ? Leaves.Num() * 4 : 0;
-	const int32 TotalEstimatedVertices = EstimatedBranchVertices + EstimatedLeafVertices;
+void UTreeGeometry::FlattenMeshData(const FTreeMeshData& MeshData,
+                                    TArray<FVector>& OutVertices,
+                                    TArray<int32>& OutTriangles,
+                                    TArray<FVector>& OutNormals,
+                                    TArray<FVector2D>& OutUVs,
+                                    TArray<FLinearColor>& OutVertexColors,
+                                    TArray<FVector>& OutTangents,
+                                    int32& OutBranchVertexCount,
+                                    int32& OutBranchTriangleCount)
+{
+	OutVertices.Reset(MeshData.GetVertexCount());
+	OutTriangles.Reset(MeshData.GetTriangleCount() * 3);
+	OutNormals.Reset(MeshData.GetVertexCount());
+	OutUVs.Reset(MeshData.GetVertexCount());
+	OutVertexColors.Reset(MeshData.GetVertexCount());
+	OutTangents.Reset(MeshData.GetVertexCount());
 
-	CurrentMeshData.Vertices.Reserve(TotalEstimatedVertices);
-	CurrentMeshData.Normals.Reserve(TotalEstimatedVertices);
-	CurrentMeshData.UVs.Reserve(TotalEstimatedVertices);
-	CurrentMeshData.Triangles.Reserve(Segments.Num() * RadialSegments * 6 + Leaves.Num() * 6);
+	OutBranchVertexCount = MeshData.Branches.GetVertexCount();
+	OutBranchTriangleCount = MeshData.Branches.GetTriangleCount();
 
-	// Generate branch geometry with connectivity
-	CurrentVCoordinate = 0.0f;
-	for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
 	{
-		const FBranchSegment& Segment = Segments[SegmentIndex];
-		GenerateBranchCylinderConnected(Segment, SegmentIndex, RadialSegments);
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+		const int32 BaseVertex = OutVertices.Num();
+
+		OutVertices.Append(Section.Vertices);
+		OutNormals.Append(Section.Normals);
+		OutUVs.Append(Section.UVs);
+
+		for (const int32 Index : Section.Triangles)
+		{
+			OutTriangles.Add(BaseVertex + Index);
+		}
+
+		// Colors are stored unconverted, so reinterpreting gives back the original linear values
+		for (const FColor& Color : Section.VertexColors)
+		{
+			OutVertexColors.Add(Color.ReinterpretAsLinear());
+		}
+
+		for (const FProcMeshTangent& Tangent : Section.Tangents)
+		{
+			OutTangents.Add(Tangent.TangentX);
+		}
 	}
+}
+
+// ============================================================================
+// Mesh Building
+// ============================================================================
+
+void UTreeGeometry::BuildMesh(FTreeMeshBuildContext& Context,
+                              const FTreeMeshTopology& Topology,
+                              const FTreeSkeleton& Skeleton,
+                              int32 RadialSegments,
+                              bool bIncludeLeaves) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_BuildMesh);
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::BuildMesh);
+
+	FTreeMeshData& CurrentMeshData = Context.MeshData;
+	CurrentMeshData.Reset();
+
+	// Clamp radial segments
+	RadialSegments = FMath::Clamp(RadialSegments, 3, 32);
+	Context.RadialSegments = RadialSegments;
 
-	// Record branch counts
-	CurrentMeshData.BranchVertexCount = CurrentMeshData.Vertices.Num();
-	CurrentMeshData.BranchTriangleCount = CurrentMeshData.Triangles.Num() / 3;
+	// Exact capacity from the topology (4 vertices and 4 triangles per double-sided leaf)
+	const int32 NumLeaves = bIncludeLeaves ? Skeleton.NumLeaves() : 0;
+	CurrentMeshData.Branches.Reserve(Topology.NumRings * RadialSegments, Topology.NumValidSegments * RadialSegments * 6);
+	CurrentMeshData.Leaves.Reserve(NumLeaves * 4, NumLeaves * 12);
+
+	// Generate branch geometry with connectivity (GenerateRing runs per ring, so it is traced as a whole here)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::GenerateRings);
+		for (int32 SegmentIndex = 0; SegmentIndex < Skeleton.NumSegments(); ++SegmentIndex)
+		{
+			const FTreeSegmentTopology& SegmentTopology = Topology.Segments[SegmentIndex];
+			if (SegmentTopology.IsValid())
+			{
+				GenerateBranchCylinderConnected(Context, Skeleton, SegmentIndex, SegmentTopology, RadialSegments);
+			}
+		}
+	}
 
 	// Generate leaf geometry
-	if (bIncludeLeaves)
 	{
-		for (const FLeafData& Leaf : Leaves)
+		TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::GenerateLeaves);
+		for (int32 LeafIndex = 0; LeafIndex < NumLeaves; ++LeafIndex)
 		{
-			GenerateLeafQuad(Leaf);
+			GenerateLeafQuad(Context, Skeleton, LeafIndex);
 		}
 	}
 
-	// Calculate tangents for normal mapping
-	CalculateTangents();
+	// Tangents were written analytically during emission; only the junction/taper pass remains
+	if (bSmoothNormals)
+	{
+		CalculateSmoothNormals(Context, Skeleton, Topology);
+	}
 
 	UE_LOG(LogTreeGeometry, Verbose, TEXT("Generated mesh: %d branch verts, %d leaf verts, %d total triangles"),
-	       CurrentMeshData.BranchVertexCount,
-	       CurrentMeshData.Vertices.Num() - CurrentMeshData.BranchVertexCount,
+	       CurrentMeshData.Branches.GetVertexCount(),
+	       CurrentMeshData.Leaves.GetVertexCount(),
 	       CurrentMeshData.GetTriangleCount());
-
-	return CurrentMeshData;
 }
 
 // ============================================================================
 // Branch Geometry
 // ============================================================================
 
-void UTreeGeometry::GenerateBranchCylinder(const FBranchSegment& Segment, int32 RadialSegments)
+void UTreeGeometry::GenerateBranchCylinder(FTreeMeshBuildContext& Context, const FBranchSegment& Segment, int32 RadialSegments) const
 {
 	// Legacy function - calls connected version with no parent
 	const float SegmentLength = Segment.GetLength();
@@ -125,108 +335,96 @@ void UTreeGeometry::GenerateBranchCylinder(const FBranchSegment& Segment, int32
 	}
 
 	// Calculate UV V coordinates
-	const float StartV = CurrentVCoordinate;
+	const float StartV = Context.VCoordinate;
 	const float EndV = StartV + (SegmentLength * BarkUVTiling / 100.0f);
-	CurrentVCoordinate = EndV;
+	Context.VCoordinate = EndV;
+
+	// Both rings share the segment's basis
+	FVector Right, Up;
+	GetPerpendicularVectors(Segment.Direction, Right, Up);
 
 	// Generate rings at start and end of segment
-	const int32 StartRingIndex = GenerateRing(Segment.StartPosition, Segment.Direction,
+	const int32 StartRingIndex = GenerateRing(Context, Segment.StartPosition, Right, Up,
 	                                           Segment.StartRadius, RadialSegments, StartV);
-	const int32 EndRingIndex = GenerateRing(Segment.EndPosition, Segment.Direction,
+	const int32 EndRingIndex = GenerateRing(Context, Segment.EndPosition, Right, Up,
 	                                         Segment.EndRadius, RadialSegments, EndV);
 
 	// Connect the rings with triangles
-	ConnectRings(StartRingIndex, EndRingIndex, RadialSegments);
+	ConnectRings(Context, StartRingIndex, EndRingIndex, RadialSegments);
 }
 
-void UTreeGeometry::GenerateBranchCylinderConnected(const FBranchSegment& Segment, int32 SegmentIndex, int32 RadialSegments)
+void UTreeGeometry::GenerateBranchCylinderConnected(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton, int32 SegmentIndex,
+                                                   const FTreeSegmentTopology& SegmentTopology, int32 RadialSegments) const
 {
-	const float SegmentLength = Segment.GetLength();
-	if (SegmentLength < KINDA_SMALL_NUMBER)
-	{
-		return;
-	}
+	// Rings are emitted in topology order, so ring ordinals map directly to vertex indices
+	const int32 StartRingIndex = SegmentTopology.StartRing * RadialSegments;
+	const int32 EndRingIndex = SegmentTopology.EndRing * RadialSegments;
 
-	// Calculate UV V coordinates
-	const float StartV = CurrentVCoordinate;
-	const float EndV = StartV + (SegmentLength * BarkUVTiling / 100.0f);
-	CurrentVCoordinate = EndV;
-
-	int32 StartRingIndex;
+	// The ring basis only depends on the segment direction - compute it once for both rings
+	FVector Right, Up;
+	GetPerpendicularVectors(FVector(Skeleton.SegmentDirections[SegmentIndex]), Right, Up);
 
-	// Check if this segment connects to a parent
-	if (Segment.ParentSegmentIndex >= 0)
-	{
-		// Look up parent's end ring
-		const int32* ParentEndRing = SegmentEndRingIndices.Find(Segment.ParentSegmentIndex);
-		if (ParentEndRing != nullptr)
-		{
-			// Reuse parent's end ring as our start ring
-			StartRingIndex = *ParentEndRing;
-		}
-		else
-		{
-			// Parent ring not found (shouldn't happen), generate new ring
-			StartRingIndex = GenerateRing(Segment.StartPosition, Segment.Direction,
-			                               Segment.StartRadius, RadialSegments, StartV);
-		}
-	}
-	else
+	// Generate a new start ring unless the parent's end ring is reused
+	if (SegmentTopology.bEmitsStartRing)
 	{
-		// No parent - generate a new start ring
-		StartRingIndex = GenerateRing(Segment.StartPosition, Segment.Direction,
-		                               Segment.StartRadius, RadialSegments, StartV);
+		GenerateRing(Context, FVector(Skeleton.SegmentStarts[SegmentIndex]), Right, Up,
+		             Skeleton.StartRadii[SegmentIndex], RadialSegments, SegmentTopology.StartV);
 	}
 
 	// Always generate end ring
-	const int32 EndRingIndex = GenerateRing(Segment.EndPosition, Segment.Direction,
-	                                         Segment.EndRadius, RadialSegments, EndV);
+	GenerateRing(Context, FVector(Skeleton.SegmentEnds[SegmentIndex]), Right, Up,
+	             Skeleton.EndRadii[SegmentIndex], RadialSegments, SegmentTopology.EndV);
 
-	// Store this segment's end ring for children to use
-	SegmentEndRingIndices.Add(SegmentIndex, EndRingIndex);
+	checkSlow(Context.MeshData.Branches.Vertices.Num() == EndRingIndex + RadialSegments);
 
 	// Connect the rings with triangles
-	ConnectRings(StartRingIndex, EndRingIndex, RadialSegments);
+	ConnectRings(Context, StartRingIndex, EndRingIndex, RadialSegments);
 }
 
-int32 UTreeGeometry::GenerateRing(const FVector& Center, const FVector& Direction, float Radius,
-                                   int32 NumSegments, float V)
+int32 UTreeGeometry::GenerateRing(FTreeMeshBuildContext& Context, const FVector& Center, const FVector& Right,
+                                   const FVector& Up, float Radius, int32 NumSegments, float V) const
 {
-	const int32 StartIndex = CurrentMeshData.Vertices.Num();
+	FTreeMeshSectionData& Section = Context.MeshData.Branches;
+	const int32 StartIndex = Section.Vertices.Num();
 
-	// Get perpendicular vectors for the ring plane
-	FVector Right, Up;
-	GetPerpendicularVectors(Direction, Right, Up);
+	const FTreeRingTemplate& Template = GetRingTemplate(NumSegments);
 
-	// Generate vertices around the ring
-	const float AngleStep = 360.0f / static_cast<float>(NumSegments);
+	// Grow all streams once, then write the ring in a branch-free loop over the template
+	Section.Vertices.AddUninitialized(NumSegments);
+	Section.Normals.AddUninitialized(NumSegments);
+	Section.UVs.AddUninitialized(NumSegments);
+	Section.VertexColors.AddUninitialized(NumSegments);
+	Section.Tangents.AddUninitialized(NumSegments);
+
+	FVector* RESTRICT Positions = Section.Vertices.GetData() + StartIndex;
+	FVector* RESTRICT Normals = Section.Normals.GetData() + StartIndex;
+	FVector2D* RESTRICT UVs = Section.UVs.GetData() + StartIndex;
+	FColor* RESTRICT Colors = Section.VertexColors.GetData() + StartIndex;
+	FProcMeshTangent* RESTRICT Tangents = Section.Tangents.GetData() + StartIndex;
 
 	for (int32 i = 0; i < NumSegments; ++i)
 	{
-		const float Angle = AngleStep * static_cast<float>(i);
-		const float AngleRad = FMath::DegreesToRadians(Angle);
+		// Right/Up are orthonormal, so the outward direction is already unit length
+		const FVector Outward = Right * Template.Cos[i] + Up * Template.Sin[i];
 
-		// Position on ring
-		const FVector Offset = (Right * FMath::Cos(AngleRad) + Up * FMath::Sin(AngleRad)) * Radius;
-		const FVector Position = Center + Offset;
+		Positions[i] = Center + Outward * Radius;
+		Normals[i] = Outward;
 
-		// Normal points outward from center
-		const FVector Normal = Offset.GetSafeNormal();
+		// dP/dU is the derivative of the circle; Normal x Tangent is the axis, i.e. dP/dV, so no binormal flip
+		Tangents[i] = FProcMeshTangent(Up * Template.Cos[i] - Right * Template.Sin[i], false);
 
 		// UV coordinates: U goes around the ring, V goes along the branch
-		const float U = static_cast<float>(i) / static_cast<float>(NumSegments);
-
-		CurrentMeshData.Vertices.Add(Position);
-		CurrentMeshData.Normals.Add(Normal);
-		CurrentMeshData.UVs.Add(FVector2D(U, V));
-		CurrentMeshData.VertexColors.Add(FLinearColor::White);
+		UVs[i] = FVector2D(Template.U[i], V);
+		Colors[i] = FColor::White;
 	}
 
 	return StartIndex;
 }
 
-void UTreeGeometry::ConnectRings(int32 StartRingIndex, int32 EndRingIndex, int32 NumSegments)
+void UTreeGeometry::ConnectRings(FTreeMeshBuildContext& Context, int32 StartRingIndex, int32 EndRingIndex, int32 NumSegments) const
 {
+	TArray<int32>& Triangles = Context.MeshData.Branches.Triangles;
+
 	// Connect the two rings with a triangle strip
 	for (int32 i = 0; i < NumSegments; ++i)
 	{
@@ -239,14 +437,14 @@ void UTreeGeometry::ConnectRings(int32 StartRingIndex, int32 EndRingIndex, int32
 		const int32 D = EndRingIndex + NextI;
 
 		// Triangle 1: A-C-B
-		CurrentMeshData.Triangles.Add(A);
-		CurrentMeshData.Triangles.Add(C);
-		CurrentMeshData.Triangles.Add(B);
+		Triangles.Add(A);
+		Triangles.Add(C);
+		Triangles.Add(B);
 
 		// Triangle 2: B-C-D
-		CurrentMeshData.Triangles.Add(B);
-		CurrentMeshData.Triangles.Add(C);
-		CurrentMeshData.Triangles.Add(D);
+		Triangles.Add(B);
+		Triangles.Add(C);
+		Triangles.Add(D);
 	}
 }
 
@@ -254,51 +452,32 @@ void UTreeGeometry::ConnectRings(int32 StartRingIndex, int32 EndRingIndex, int32
 // Leaf Geometry
 // ============================================================================
 
-void UTreeGeometry::GenerateLeafQuad(const FLeafData& Leaf)
+void UTreeGeometry::GenerateLeafQuad(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton, int32 LeafIndex) const
 {
-	const int32 StartIndex = CurrentMeshData.Vertices.Num();
+	FTreeMeshSectionData& Section = Context.MeshData.Leaves;
+	const int32 StartIndex = Section.Vertices.Num();
+
+	const FVector Position(Skeleton.LeafPositions[LeafIndex]);
+	const FVector Normal(Skeleton.LeafNormals[LeafIndex]);
+	const FVector UpDirection(Skeleton.LeafUps[LeafIndex]);
 
 	// Get leaf orientation vectors
 	FVector LeafRight, LeafUp;
-
-	// Use the leaf's up direction, but ensure it's perpendicular to normal
-	LeafUp = Leaf.UpDirection - Leaf.Normal * FVector::DotProduct(Leaf.UpDirection, Leaf.Normal);
-	if (LeafUp.IsNearlyZero())
-	{
-		GetPerpendicularVectors(Leaf.Normal, LeafRight, LeafUp);
-	}
-	else
-	{
-		LeafUp.Normalize();
-		LeafRight = FVector::CrossProduct(Leaf.Normal, LeafUp).GetSafeNormal();
-	}
-
-	// Apply random rotation around normal
-	if (!FMath::IsNearlyZero(Leaf.Rotation))
-	{
-		const float RotRad = FMath::DegreesToRadians(Leaf.Rotation);
-		const float Cos = FMath::Cos(RotRad);
-		const float Sin = FMath::Sin(RotRad);
-
-		const FVector NewRight = LeafRight * Cos + LeafUp * Sin;
-		const FVector NewUp = -LeafRight * Sin + LeafUp * Cos;
-
-		LeafRight = NewRight;
-		LeafUp = NewUp;
-	}
+	GetLeafBasis(Normal, UpDirection, Skeleton.LeafRotations[LeafIndex], LeafRight, LeafUp);
 
 	// Get leaf size
-	const FVector2D Size = Leaf.Size.IsNearlyZero() ? DefaultLeafSize : Leaf.Size;
+	const FVector2D LeafSize(Skeleton.LeafSizes[LeafIndex]);
+	const FVector2D Size = LeafSize.IsNearlyZero() ? DefaultLeafSize : LeafSize;
 	const float HalfWidth = Size.X * 0.5f;
 	const float HalfHeight = Size.Y * 0.5f;
 
 	// Generate 4 corners of the quad
 	// Quad is centered at leaf position
 	const FVector Corners[4] = {
-		Leaf.Position - LeafRight * HalfWidth - LeafUp * HalfHeight, // Bottom-left
-		Leaf.Position + LeafRight * HalfWidth - LeafUp * HalfHeight, // Bottom-right
-		Leaf.Position + LeafRight * HalfWidth + LeafUp * HalfHeight, // Top-right
-		Leaf.Position - LeafRight * HalfWidth + LeafUp * HalfHeight  // Top-left
+		Position - LeafRight * HalfWidth - LeafUp * HalfHeight, // Bottom-left
+		Position + LeafRight * HalfWidth - LeafUp * HalfHeight, // Bottom-right
+		Position + LeafRight * HalfWidth + LeafUp * HalfHeight, // Top-right
+		Position - LeafRight * HalfWidth + LeafUp * HalfHeight  // Top-left
 	};
 
 	// UV coordinates for leaf texture
@@ -310,50 +489,216 @@ void UTreeGeometry::GenerateLeafQuad(const FLeafData& Leaf)
 	};
 
 	// Leaf color (could vary based on depth)
-	const FLinearColor LeafColor = FLinearColor(0.2f, 0.6f, 0.2f, 1.0f);
+	static const FColor LeafColor = FLinearColor(0.2f, 0.6f, 0.2f, 1.0f).ToFColor(false);
+
+	// U runs along LeafRight and V runs down the leaf; Normal x LeafRight = -LeafUp = dP/dV, so no binormal flip
+	const FProcMeshTangent LeafTangent(LeafRight, false);
 
 	// Add vertices
 	for (int32 i = 0; i < 4; ++i)
 	{
-		CurrentMeshData.Vertices.Add(Corners[i]);
-		CurrentMeshData.Normals.Add(Leaf.Normal);
-		CurrentMeshData.UVs.Add(UVs[i]);
-		CurrentMeshData.VertexColors.Add(LeafColor);
+		Section.Vertices.Add(Corners[i]);
+		Section.Normals.Add(Normal);
+		Section.UVs.Add(UVs[i]);
+		Section.VertexColors.Add(LeafColor);
+		Section.Tangents.Add(LeafTangent);
 	}
 
 	// Add triangles (two triangles for the quad)
 	// Triangle 1: 0-1-2
-	CurrentMeshData.Triangles.Add(StartIndex + 0);
-	CurrentMeshData.Triangles.Add(StartIndex + 1);
-	CurrentMeshData.Triangles.Add(StartIndex + 2);
+	Section.Triangles.Add(StartIndex + 0);
+	Section.Triangles.Add(StartIndex + 1);
+	Section.Triangles.Add(StartIndex + 2);
 
 	// Triangle 2: 0-2-3
-	CurrentMeshData.Triangles.Add(StartIndex + 0);
-	CurrentMeshData.Triangles.Add(StartIndex + 2);
-	CurrentMeshData.Triangles.Add(StartIndex + 3);
+	Section.Triangles.Add(StartIndex + 0);
+	Section.Triangles.Add(StartIndex + 2);
+	Section.Triangles.Add(StartIndex + 3);
 
 	// Add back faces for double-sided leaves
 	// Triangle 3: 2-1-0
-	CurrentMeshData.Triangles.Add(StartIndex + 2);
-	CurrentMeshData.Triangles.Add(StartIndex + 1);
-	CurrentMeshData.Triangles.Add(StartIndex + 0);
+	Section.Triangles.Add(StartIndex + 2);
+	Section.Triangles.Add(StartIndex + 1);
+	Section.Triangles.Add(StartIndex + 0);
 
 	// Triangle 4: 3-2-0
-	CurrentMeshData.Triangles.Add(StartIndex + 3);
-	CurrentMeshData.Triangles.Add(StartIndex + 2);
-	CurrentMeshData.Triangles.Add(StartIndex + 0);
+	Section.Triangles.Add(StartIndex + 3);
+	Section.Triangles.Add(StartIndex + 2);
+	Section.Triangles.Add(StartIndex + 0);
+}
+
+void UTreeGeometry::GetLeafBasis(const FVector& Normal, const FVector& UpDirection, float Rotation,
+                                 FVector& OutRight, FVector& OutUp)
+{
+	// Use the leaf's up direction, but ensure it's perpendicular to normal
+	OutUp = UpDirection - Normal * FVector::DotProduct(UpDirection, Normal);
+	if (OutUp.IsNearlyZero())
+	{
+		GetPerpendicularVectors(Normal, OutRight, OutUp);
+	}
+	else
+	{
+		OutUp.Normalize();
+		OutRight = FVector::CrossProduct(Normal, OutUp).GetSafeNormal();
+	}
+
+	// Apply random rotation around normal
+	if (!FMath::IsNearlyZero(Rotation))
+	{
+		const float RotRad = FMath::DegreesToRadians(Rotation);
+		const float Cos = FMath::Cos(RotRad);
+		const float Sin = FMath::Sin(RotRad);
+
+		const FVector NewRight = OutRight * Cos + OutUp * Sin;
+		const FVector NewUp = -OutRight * Sin + OutUp * Cos;
+
+		OutRight = NewRight;
+		OutUp = NewUp;
+	}
 }
 
 // ============================================================================
-// Utility Methods
+// Instanced Leaves
 // ============================================================================
 
-void UTreeGeometry::ResetMeshData()
+void UTreeGeometry::BuildLeafInstanceTransforms(const FTreeSkeleton& Skeleton, const FVector2D& CardSize,
+                                                TArray<FTransform>& OutTransforms) const
 {
-	CurrentMeshData.Reset();
-	CurrentVCoordinate = 0.0f;
+	const int32 NumLeaves = Skeleton.NumLeaves();
+	OutTransforms.SetNumUninitialized(NumLeaves);
+
+	const FVector2D SafeCardSize(FMath::Max(CardSize.X, KINDA_SMALL_NUMBER), FMath::Max(CardSize.Y, KINDA_SMALL_NUMBER));
+
+	for (int32 LeafIndex = 0; LeafIndex < NumLeaves; ++LeafIndex)
+	{
+		const FVector Normal(Skeleton.LeafNormals[LeafIndex]);
+
+		FVector LeafRight, LeafUp;
+		GetLeafBasis(Normal, FVector(Skeleton.LeafUps[LeafIndex]), Skeleton.LeafRotations[LeafIndex], LeafRight, LeafUp);
+
+		const FVector2D LeafSize(Skeleton.LeafSizes[LeafIndex]);
+		const FVector2D Size = LeafSize.IsNearlyZero() ? DefaultLeafSize : LeafSize;
+
+		// (Up, Right, Normal) is right-handed since Right = Normal x Up
+		const FMatrix Basis(LeafUp, LeafRight, Normal, FVector(Skeleton.LeafPositions[LeafIndex]));
+		OutTransforms[LeafIndex] = FTransform(Basis);
+		OutTransforms[LeafIndex].SetScale3D(FVector(Size.Y / SafeCardSize.X, Size.X / SafeCardSize.Y, 1.0f));
+	}
+}
+
+// ============================================================================
+// Collision
+// ============================================================================
+
+/** Largest bend (degrees) between a capsule's axis and a segment still merged into it */
+static constexpr float CapsuleMergeAngle = 12.0f;
+
+/** A chain stops growing once a segment is thinner than this fraction of the chain's start radius */
+static constexpr float CapsuleMinTaper = 0.5f;
+
+void UTreeGeometry::BuildCollisionCapsules(const FTreeSkeleton& Skeleton, int32 MaxDepth, float MinRadius, int32 MaxCapsules,
+                                           TArray<FKSphylElem>& OutCapsules)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::BuildCollisionCapsules);
+
+	OutCapsules.Reset();
+
+	/** A straight run of segments covered by one capsule */
+	struct FCapsuleChain
+	{
+		FVector Start;
+		FVector End;
+		float StartRadius;
+		float RadiusLengthSum;
+		float Length;
+		int32 TailSegment;
+	};
+
+	const float MergeCos = FMath::Cos(FMath::DegreesToRadians(CapsuleMergeAngle));
+	const int32 NumSegments = Skeleton.NumSegments();
+
+	TArray<FCapsuleChain> Chains;
+	TTreeScratch<TArray<int32>> SegmentChainScratch;
+	TArray<int32>& SegmentChains = *SegmentChainScratch;
+	SegmentChains.Init(INDEX_NONE, NumSegments);
+
+	// Parents precede children, so a single forward pass can extend chains from their tail
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+	{
+		const float StartRadius = Skeleton.StartRadii[SegmentIndex];
+		const float EndRadius = Skeleton.EndRadii[SegmentIndex];
+		const float AverageRadius = 0.5f * (StartRadius + EndRadius);
+		const float Length = Skeleton.GetSegmentLength(SegmentIndex);
+
+		if (Skeleton.SegmentDepths[SegmentIndex] > MaxDepth || AverageRadius < MinRadius || Length < KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const FVector Start(Skeleton.SegmentStarts[SegmentIndex]);
+		const FVector End(Skeleton.SegmentEnds[SegmentIndex]);
+
+		const int32 ParentIndex = Skeleton.ParentIndices[SegmentIndex];
+		const int32 ParentChain = ParentIndex >= 0 ? SegmentChains[ParentIndex] : INDEX_NONE;
+
+		// Only the first straight continuation extends a chain; side branches start their own
+		if (ParentChain != INDEX_NONE)
+		{
+			FCapsuleChain& Chain = Chains[ParentChain];
+			const FVector ChainAxis = (Chain.End - Chain.Start).GetSafeNormal();
+
+			if (Chain.TailSegment == ParentIndex &&
+			    FVector::DotProduct(ChainAxis, FVector(Skeleton.SegmentDirections[SegmentIndex])) >= MergeCos &&
+			    EndRadius >= Chain.StartRadius * CapsuleMinTaper)
+			{
+				Chain.End = End;
+				Chain.RadiusLengthSum += AverageRadius * Length;
+				Chain.Length += Length;
+				Chain.TailSegment = SegmentIndex;
+				SegmentChains[SegmentIndex] = ParentChain;
+				continue;
+			}
+		}
+
+		FCapsuleChain& Chain = Chains.AddDefaulted_GetRef();
+		Chain.Start = Start;
+		Chain.End = End;
+		Chain.StartRadius = StartRadius;
+		Chain.RadiusLengthSum = AverageRadius * Length;
+		Chain.Length = Length;
+		Chain.TailSegment = SegmentIndex;
+		SegmentChains[SegmentIndex] = Chains.Num() - 1;
+	}
+
+	OutCapsules.Reserve(Chains.Num());
+	for (const FCapsuleChain& Chain : Chains)
+	{
+		const FVector Axis = Chain.End - Chain.Start;
+		const float AxisLength = Axis.Size();
+
+		// Length-weighted mean radius; the sphyl's cylinder spans the chain, caps overlap the neighbours
+		FKSphylElem& Capsule = OutCapsules.Emplace_GetRef(Chain.RadiusLengthSum / Chain.Length, AxisLength);
+		Capsule.Center = (Chain.Start + Chain.End) * 0.5f;
+		Capsule.Rotation = FRotationMatrix::MakeFromZ(Axis / AxisLength).Rotator();
+	}
+
+	// Keep the largest volumes when over budget
+	if (MaxCapsules > 0 && OutCapsules.Num() > MaxCapsules)
+	{
+		OutCapsules.Sort([](const FKSphylElem& A, const FKSphylElem& B)
+		{
+			return A.Radius * A.Radius * A.Length > B.Radius * B.Radius * B.Length;
+		});
+		OutCapsules.SetNum(MaxCapsules);
+	}
+
+	UE_LOG(LogTreeGeometry, Verbose, TEXT("Built %d collision capsules from %d segments"), OutCapsules.Num(), NumSegments);
 }
 
+// ============================================================================
+// Utility Methods
+// ============================================================================
+
 void UTreeGeometry::GetPerpendicularVectors(const FVector& Direction, FVector& OutRight, FVector& OutUp)
 {
 	const FVector NormalizedDir = Direction.GetSafeNormal();
@@ -374,33 +719,95 @@ void UTreeGeometry::GetPerpendicularVectors(const FVector& Direction, FVector& O
 	OutUp = FVector::CrossProduct(NormalizedDir, OutRight).GetSafeNormal();
 }
 
-void UTreeGeometry::CalculateSmoothNormals()
+void UTreeGeometry::CalculateSmoothNormals(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton,
+                                           const FTreeMeshTopology& Topology) const
 {
-	// Normals are calculated per-vertex during generation
-	// This method could be used for post-processing if needed
-}
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGeometry::CalculateSmoothNormals);
 
-void UTreeGeometry::CalculateTangents()
-{
-	const int32 NumVertices = CurrentMeshData.Vertices.Num();
-	CurrentMeshData.Tangents.SetNum(NumVertices);
+	FTreeMeshSectionData& Section = Context.MeshData.Branches;
+	const int32 RadialSegments = Context.RadialSegments;
+	if (Topology.NumRings == 0 || Section.Vertices.Num() != Topology.NumRings * RadialSegments)
+	{
+		return;
+	}
 
-	// Calculate tangents based on UV direction
-	for (int32 i = 0; i < NumVertices; ++i)
+	/** Radius-weighted sums of the bands touching one ring */
+	struct FRingAxis
 	{
-		const FVector& Normal = CurrentMeshData.Normals[i];
+		FVector Axis = FVector::ZeroVector;
+		float Slope = 0.0f;
+		float Weight = 0.0f;
+	};
 
-		// Find a tangent perpendicular to the normal
-		FVector Tangent;
-		if (FMath::Abs(Normal.Z) < 0.9f)
+	// Gather pass, O(segments): every band contributes to its start and end ring
+	TTreeScratch<TArray<FRingAxis>> RingAxisScratch;
+	TArray<FRingAxis>& RingAxes = *RingAxisScratch;
+	RingAxes.SetNum(Topology.NumRings);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < Skeleton.NumSegments(); ++SegmentIndex)
+	{
+		const FTreeSegmentTopology& SegmentTopology = Topology.Segments[SegmentIndex];
+		if (!SegmentTopology.IsValid())
 		{
-			Tangent = FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal();
+			continue;
 		}
-		else
+
+		// A reused start ring has the parent's end radius, whatever the child's own start radius is
+		const int32 ParentIndex = Skeleton.ParentIndices[SegmentIndex];
+		const float StartRadius = SegmentTopology.bEmitsStartRing ? Skeleton.StartRadii[SegmentIndex] : Skeleton.EndRadii[ParentIndex];
+		const float EndRadius = Skeleton.EndRadii[SegmentIndex];
+
+		// A cone's surface normal leans towards its thin end by (StartRadius - EndRadius) / Length
+		const float Slope = (StartRadius - EndRadius) / Skeleton.GetSegmentLength(SegmentIndex);
+		const float Weight = FMath::Max(0.5f * (StartRadius + EndRadius), KINDA_SMALL_NUMBER);
+		const FVector WeightedAxis = FVector(Skeleton.SegmentDirections[SegmentIndex]) * Weight;
+
+		for (const int32 Ring : { SegmentTopology.StartRing, SegmentTopology.EndRing })
 		{
-			Tangent = FVector::CrossProduct(FVector::ForwardVector, Normal).GetSafeNormal();
+			FRingAxis& RingAxis = RingAxes[Ring];
+			RingAxis.Axis += WeightedAxis;
+			RingAxis.Slope += Slope * Weight;
+			RingAxis.Weight += Weight;
 		}
-
-		CurrentMeshData.Tangents[i] = Tangent;
 	}
+
+	// Vertex pass: rings own contiguous vertex ranges, so chunks of rings are independent
+	constexpr int32 RingsPerTask = 256;
+	const int32 NumTasks = FMath::DivideAndRoundUp(Topology.NumRings, RingsPerTask);
+
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		const int32 FirstRing = TaskIndex * RingsPerTask;
+		const int32 LastRing = FMath::Min(FirstRing + RingsPerTask, Topology.NumRings);
+
+		for (int32 Ring = FirstRing; Ring < LastRing; ++Ring)
+		{
+			const FRingAxis& RingAxis = RingAxes[Ring];
+			const FVector Axis = RingAxis.Axis.GetSafeNormal();
+			if (Axis.IsZero())
+			{
+				continue;
+			}
+
+			// The radial part and the axis are orthogonal, so (Radial + Axis * Slope) always has length sqrt(1 + Slope^2)
+			const float Slope = RingAxis.Slope / RingAxis.Weight;
+			const float LengthScale = FMath::InvSqrt(1.0f + Slope * Slope);
+			const FVector AxisLean = Axis * (Slope * LengthScale);
+
+			FVector* RESTRICT Normals = Section.Normals.GetData() + Ring * RadialSegments;
+			FProcMeshTangent* RESTRICT Tangents = Section.Tangents.GetData() + Ring * RadialSegments;
+
+			for (int32 i = 0; i < RadialSegments; ++i)
+			{
+				const FVector Radial = Normals[i] - Axis * FVector::DotProduct(Normals[i], Axis);
+				const FVector Normal = Radial * (FMath::InvSqrt(FMath::Max(Radial.SizeSquared(), SMALL_NUMBER)) * LengthScale) + AxisLean;
+
+				// Gram-Schmidt keeps the tangent on the ring direction (dP/dU)
+				const FVector Tangent = Tangents[i].TangentX - Normal * FVector::DotProduct(Tangents[i].TangentX, Normal);
+
+				Normals[i] = Normal;
+				Tangents[i].TangentX = Tangent * FMath::InvSqrt(FMath::Max(Tangent.SizeSquared(), SMALL_NUMBER));
+			}
+		}
+	});
 }
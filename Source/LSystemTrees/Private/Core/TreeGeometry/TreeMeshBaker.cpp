@@ -0,0 +1,215 @@
+// TreeMeshBaker.cpp
+// Bakes generated tree mesh LODs into UStaticMesh assets
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/TreeGeometry/TreeMeshBaker.h"
+#include "Core/TreeGeometry/TreeGeometry.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "UObject/Package.h"
+
+const FName UTreeMeshBaker::BarkSlotName(TEXT("Bark"));
+const FName UTreeMeshBaker::LeafSlotName(TEXT("Leaves"));
+
+// ============================================================================
+// Mesh Description
+// ============================================================================
+
+void UTreeMeshBaker::BuildMeshDescription(const FTreeMeshData& MeshData, FMeshDescription& OutMeshDescription)
+{
+	FStaticMeshAttributes Attributes(OutMeshDescription);
+	Attributes.Register();
+
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+	TVertexInstanceAttributesRef<float> BinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	TVertexInstanceAttributesRef<FVector4f> Colors = Attributes.GetVertexInstanceColors();
+	TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+	UVs.SetNumChannels(1);
+
+	const int32 TotalVertices = MeshData.GetVertexCount();
+	const int32 TotalTriangles = MeshData.GetTriangleCount();
+	OutMeshDescription.ReserveNewVertices(TotalVertices);
+	OutMeshDescription.ReserveNewVertexInstances(TotalVertices);
+	OutMeshDescription.ReserveNewTriangles(TotalTriangles);
+	OutMeshDescription.ReserveNewPolygons(TotalTriangles);
+	OutMeshDescription.ReserveNewEdges(TotalTriangles * 3);
+
+	TArray<FVertexInstanceID> InstanceIDs;
+
+	// Polygon groups are always created in slot order so group N uses material slot N
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+
+		const FPolygonGroupID PolygonGroup = OutMeshDescription.CreatePolygonGroup();
+		SlotNames[PolygonGroup] = (SectionIndex == FTreeMeshData::BranchSectionIndex) ? BarkSlotName : LeafSlotName;
+
+		if (!Section.IsValid())
+		{
+			continue;
+		}
+
+		const int32 NumVertices = Section.Vertices.Num();
+		const bool bHasNormals = Section.Normals.Num() == NumVertices;
+		const bool bHasTangents = Section.Tangents.Num() == NumVertices;
+		const bool bHasUVs = Section.UVs.Num() == NumVertices;
+		const bool bHasColors = Section.VertexColors.Num() == NumVertices;
+
+		// One vertex instance per section vertex (seams and ring duplicates stay exactly as generated)
+		InstanceIDs.Reset(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVertexID VertexID = OutMeshDescription.CreateVertex();
+			Positions[VertexID] = FVector3f(Section.Vertices[i]);
+
+			const FVertexInstanceID InstanceID = OutMeshDescription.CreateVertexInstance(VertexID);
+			Normals[InstanceID] = bHasNormals ? FVector3f(Section.Normals[i]) : FVector3f::UpVector;
+			Tangents[InstanceID] = bHasTangents ? FVector3f(Section.Tangents[i].TangentX) : FVector3f::ForwardVector;
+			BinormalSigns[InstanceID] = (bHasTangents && Section.Tangents[i].bFlipTangentY) ? -1.0f : 1.0f;
+			UVs.Set(InstanceID, 0, bHasUVs ? FVector2f(Section.UVs[i]) : FVector2f::ZeroVector);
+			Colors[InstanceID] = bHasColors ? FVector4f(FLinearColor(Section.VertexColors[i])) : FVector4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+			InstanceIDs.Add(InstanceID);
+		}
+
+		// Same winding as the procedural mesh component
+		for (int32 i = 0; i + 2 < Section.Triangles.Num(); i += 3)
+		{
+			const FVertexInstanceID Corners[3] = {
+				InstanceIDs[Section.Triangles[i]],
+				InstanceIDs[Section.Triangles[i + 1]],
+				InstanceIDs[Section.Triangles[i + 2]]
+			};
+			OutMeshDescription.CreateTriangle(PolygonGroup, Corners);
+		}
+	}
+}
+
+// ============================================================================
+// Static Mesh Baking
+// ============================================================================
+
+UStaticMesh* UTreeMeshBaker::BakeStaticMesh(UObject* Outer, const TArray<FTreeMeshData>& LODs,
+                                            const TArray<FTreeLODLevel>& LODLevels,
+                                            UMaterialInterface* BarkMaterial, UMaterialInterface* LeafMaterial,
+                                            const FTreeBakeSettings& Settings, FName MeshName)
+{
+	const int32 NumLODs = FMath::Min(LODs.Num(), static_cast<int32>(MAX_STATIC_MESH_LODS));
+	if (NumLODs == 0 || !LODs[0].IsValid())
+	{
+		UE_LOG(LogTreeGeometry, Warning, TEXT("TreeMeshBaker: No mesh data to bake"));
+		return nullptr;
+	}
+
+	if (!Outer)
+	{
+		Outer = GetTransientPackage();
+	}
+
+	if (MeshName.IsNone())
+	{
+		MeshName = MakeUniqueObjectName(Outer, UStaticMesh::StaticClass(), TEXT("TreeMesh"));
+	}
+
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, MeshName);
+
+	// Slot order matches the polygon group order written by BuildMeshDescription
+	StaticMesh->GetStaticMaterials().Add(FStaticMaterial(BarkMaterial, BarkSlotName, BarkSlotName));
+	StaticMesh->GetStaticMaterials().Add(FStaticMaterial(LeafMaterial, LeafSlotName, LeafSlotName));
+
+	TArray<FMeshDescription> MeshDescriptions;
+	MeshDescriptions.SetNum(NumLODs);
+
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+	{
+		BuildMeshDescription(LODs[LODIndex], MeshDescriptions[LODIndex]);
+	}
+
+	auto GetScreenSize = [&LODLevels](int32 LODIndex)
+	{
+		return LODLevels.IsValidIndex(LODIndex) ? LODLevels[LODIndex].ScreenSize : 1.0f / (1 << LODIndex);
+	};
+
+#if WITH_EDITOR
+	// Source model path: the mesh can be saved as an asset and Nanite data is built
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+	{
+		FStaticMeshSourceModel& SourceModel = StaticMesh->AddSourceModel();
+		SourceModel.BuildSettings.bRecomputeNormals = false;
+		SourceModel.BuildSettings.bRecomputeTangents = false;
+		SourceModel.BuildSettings.bGenerateLightmapUVs = false;
+		SourceModel.ScreenSize.Default = GetScreenSize(LODIndex);
+
+		FMeshDescription* MeshDescription = StaticMesh->CreateMeshDescription(LODIndex);
+		*MeshDescription = MoveTemp(MeshDescriptions[LODIndex]);
+		StaticMesh->CommitMeshDescription(LODIndex);
+
+		// Empty leaf groups emit no render section, so map sections to slots explicitly
+		int32 SectionIndex = 0;
+		for (int32 Slot = 0; Slot < FTreeMeshData::NumSections; ++Slot)
+		{
+			if (LODs[LODIndex].GetSection(Slot).IsValid())
+			{
+				StaticMesh->GetSectionInfoMap().Set(LODIndex, SectionIndex++, FMeshSectionInfo(Slot));
+			}
+		}
+	}
+
+	StaticMesh->bAutoComputeLODScreenSize = false;
+	StaticMesh->NaniteSettings.bEnabled = Settings.bEnableNanite;
+
+	if (Settings.bBuildCollision)
+	{
+		StaticMesh->CreateBodySetup();
+		StaticMesh->GetBodySetup()->CollisionTraceFlag = CTF_UseComplexAsSimple;
+	}
+
+	StaticMesh->Build(true);
+	StaticMesh->PostEditChange();
+#else
+	if (Settings.bEnableNanite)
+	{
+		UE_LOG(LogTreeGeometry, Warning, TEXT("TreeMeshBaker: Nanite requires an editor build, baking '%s' without Nanite"),
+		       *MeshName.ToString());
+	}
+
+	// Runtime path: build render data directly from the mesh descriptions
+	TArray<const FMeshDescription*> MeshDescriptionPtrs;
+	for (const FMeshDescription& MeshDescription : MeshDescriptions)
+	{
+		MeshDescriptionPtrs.Add(&MeshDescription);
+	}
+
+	UStaticMesh::FBuildMeshDescriptionsParams Params;
+	Params.bBuildSimpleCollision = Settings.bBuildCollision;
+	Params.bFastBuild = true;
+	Params.bAllowCpuAccess = Settings.bAllowCPUAccess;
+
+	if (!StaticMesh->BuildFromMeshDescriptions(MeshDescriptionPtrs, Params))
+	{
+		UE_LOG(LogTreeGeometry, Error, TEXT("TreeMeshBaker: Failed to build static mesh '%s'"), *MeshName.ToString());
+		return nullptr;
+	}
+
+	if (FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData())
+	{
+		for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+		{
+			RenderData->ScreenSize[LODIndex].Default = GetScreenSize(LODIndex);
+		}
+	}
+#endif
+
+	UE_LOG(LogTreeGeometry, Log, TEXT("TreeMeshBaker: Baked '%s' with %d LODs (%d verts at LOD 0)"),
+	       *MeshName.ToString(), NumLODs, LODs[0].GetVertexCount());
+
+	return StaticMesh;
+}
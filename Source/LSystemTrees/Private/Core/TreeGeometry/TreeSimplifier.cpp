@@ -0,0 +1,200 @@
+// TreeSimplifier.cpp
+// Topology-aware skeleton simplification for lower LODs
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/TreeGeometry/TreeSimplifier.h"
+#include "Core/TreeGeometry/TreeGeometry.h"
+#include "Core/Utilities/TreeScratch.h"
+#include "Core/Utilities/TreeStats.h"
+
+namespace
+{
+	/** Parent of a segment, or INDEX_NONE if it has none (or it does not precede the segment) */
+	int32 GetValidParent(const FTreeSkeleton& Skeleton, int32 SegmentIndex)
+	{
+		const int32 Parent = Skeleton.ParentIndices[SegmentIndex];
+		return (Parent >= 0 && Parent < SegmentIndex) ? Parent : INDEX_NONE;
+	}
+
+	/** Bounds and root of one pruned twig cluster */
+	struct FPrunedCluster
+	{
+		int32 RootSegment = INDEX_NONE;
+		FBox3f Bounds = FBox3f(ForceInit);
+	};
+}
+
+// ============================================================================
+// Simplification
+// ============================================================================
+
+void FTreeSimplifier::Simplify(const FTreeSkeleton& Skeleton, const FTreeLODLevel& LOD, FTreeSkeleton& OutSkeleton)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeSimplifier::Simplify);
+
+	const int32 NumSegments = Skeleton.NumSegments();
+	OutSkeleton.Reset();
+
+	// ========== Pruning ==========
+
+	// Total length grown from each segment (children follow their parent, so one reverse pass suffices)
+	// Working arrays are borrowed from the thread's scratch pool (one simplification per LOD and tree)
+	TTreeScratch<TArray<float>> SubtreeLengthScratch;
+	TArray<float>& SubtreeLength = *SubtreeLengthScratch;
+	SubtreeLength.SetNumUninitialized(NumSegments);
+	for (int32 i = 0; i < NumSegments; ++i)
+	{
+		SubtreeLength[i] = Skeleton.GetSegmentLength(i);
+	}
+	for (int32 i = NumSegments - 1; i >= 0; --i)
+	{
+		const int32 Parent = GetValidParent(Skeleton, i);
+		if (Parent != INDEX_NONE)
+		{
+			SubtreeLength[Parent] += SubtreeLength[i];
+		}
+	}
+
+	// Pruning a segment prunes everything above it; each pruned root starts a cluster
+	TTreeScratch<TArray<int32>> ClusterIndexScratch;
+	TArray<int32>& ClusterIndices = *ClusterIndexScratch;
+	ClusterIndices.Init(INDEX_NONE, NumSegments);
+	TTreeScratch<TArray<FPrunedCluster>> ClusterScratch;
+	TArray<FPrunedCluster>& Clusters = *ClusterScratch;
+
+	for (int32 i = 0; i < NumSegments; ++i)
+	{
+		const int32 Parent = GetValidParent(Skeleton, i);
+
+		int32 Cluster = Parent != INDEX_NONE ? ClusterIndices[Parent] : INDEX_NONE;
+		if (Cluster == INDEX_NONE)
+		{
+			const bool bTooThin = LOD.MinBranchRadius > 0.0f && Skeleton.StartRadii[i] < LOD.MinBranchRadius;
+			const bool bTooShort = LOD.MinBranchLength > 0.0f && SubtreeLength[i] < LOD.MinBranchLength;
+			if (!bTooThin && !bTooShort)
+			{
+				continue;
+			}
+
+			Cluster = Clusters.AddDefaulted();
+			Clusters[Cluster].RootSegment = i;
+		}
+
+		ClusterIndices[i] = Cluster;
+		Clusters[Cluster].Bounds += Skeleton.SegmentStarts[i];
+		Clusters[Cluster].Bounds += Skeleton.SegmentEnds[i];
+	}
+
+	// ========== Leaves and Cards ==========
+
+	if (LOD.bIncludeLeaves)
+	{
+		OutSkeleton.LeafPositions = Skeleton.LeafPositions;
+		OutSkeleton.LeafNormals = Skeleton.LeafNormals;
+		OutSkeleton.LeafUps = Skeleton.LeafUps;
+		OutSkeleton.LeafSizes = Skeleton.LeafSizes;
+		OutSkeleton.LeafRotations = Skeleton.LeafRotations;
+		OutSkeleton.LeafDepths = Skeleton.LeafDepths;
+	}
+
+	if (LOD.bReplacePrunedWithCards)
+	{
+		for (const FPrunedCluster& Cluster : Clusters)
+		{
+			const FVector Center(Cluster.Bounds.GetCenter());
+			const FVector RootStart(Skeleton.SegmentStarts[Cluster.RootSegment]);
+
+			// Card grows from the cluster's attachment point towards its center
+			FVector Up = (Center - RootStart).GetSafeNormal();
+			if (Up.IsNearlyZero())
+			{
+				Up = FVector(Skeleton.SegmentDirections[Cluster.RootSegment]);
+			}
+
+			FVector Normal = FVector::CrossProduct(Up, FVector::UpVector).GetSafeNormal();
+			if (Normal.IsNearlyZero())
+			{
+				Normal = FVector::ForwardVector;
+			}
+
+			const float Side = FMath::Max(Cluster.Bounds.GetSize().GetMax(), KINDA_SMALL_NUMBER);
+			OutSkeleton.AddLeaf(Center, Normal, Up, FVector2D(Side, Side), 0.0f,
+			                    Skeleton.SegmentDepths[Cluster.RootSegment]);
+		}
+	}
+
+	// ========== Chain Merging ==========
+
+	// Kept children of each segment (and the child itself when there is exactly one)
+	TTreeScratch<TArray<int32>> KeptChildCountScratch;
+	TArray<int32>& KeptChildCounts = *KeptChildCountScratch;
+	KeptChildCounts.Init(0, NumSegments);
+	TTreeScratch<TArray<int32>> OnlyChildScratch;
+	TArray<int32>& OnlyChildren = *OnlyChildScratch;
+	OnlyChildren.Init(INDEX_NONE, NumSegments);
+
+	for (int32 i = 0; i < NumSegments; ++i)
+	{
+		const int32 Parent = GetValidParent(Skeleton, i);
+		if (ClusterIndices[i] == INDEX_NONE && Parent != INDEX_NONE)
+		{
+			KeptChildCounts[Parent]++;
+			OnlyChildren[Parent] = i;
+		}
+	}
+
+	// Above 1 no direction passes, which disables merging
+	const float MergeCos = LOD.MergeAngleThreshold > 0.0f ? FMath::Cos(FMath::DegreesToRadians(LOD.MergeAngleThreshold)) : 2.0f;
+
+	// Original segment -> simplified segment (INDEX_NONE until emitted, absorbed segments map to their chain)
+	TTreeScratch<TArray<int32>> RemapScratch;
+	TArray<int32>& Remap = *RemapScratch;
+	Remap.Init(INDEX_NONE, NumSegments);
+
+	for (int32 Head = 0; Head < NumSegments; ++Head)
+	{
+		if (ClusterIndices[Head] != INDEX_NONE || Remap[Head] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Extend while there is exactly one continuation, attached and close to the chain's direction
+		const FVector3f HeadDirection = Skeleton.SegmentDirections[Head];
+		int32 Tail = Head;
+		while (KeptChildCounts[Tail] == 1)
+		{
+			const int32 Child = OnlyChildren[Tail];
+			if (FVector3f::DotProduct(HeadDirection, Skeleton.SegmentDirections[Child]) < MergeCos ||
+			    !Skeleton.SegmentStarts[Child].Equals(Skeleton.SegmentEnds[Tail], 0.01f))
+			{
+				break;
+			}
+			Tail = Child;
+		}
+
+		const FVector Start(Skeleton.SegmentStarts[Head]);
+		const FVector End(Skeleton.SegmentEnds[Tail]);
+		FVector Direction = (End - Start).GetSafeNormal();
+		if (Direction.IsNearlyZero())
+		{
+			Direction = FVector(HeadDirection);
+		}
+
+		const int32 Parent = GetValidParent(Skeleton, Head);
+		const int32 OutIndex = OutSkeleton.AddSegment(Start, End, Direction,
+			Skeleton.StartRadii[Head], Skeleton.EndRadii[Tail], Skeleton.SegmentDepths[Head],
+			Parent != INDEX_NONE ? Remap[Parent] : INDEX_NONE);
+
+		for (int32 Member = Tail; ; Member = Skeleton.ParentIndices[Member])
+		{
+			Remap[Member] = OutIndex;
+			if (Member == Head)
+			{
+				break;
+			}
+		}
+	}
+
+	UE_LOG(LogTreeGeometry, Verbose, TEXT("Simplified skeleton: %d -> %d segments, %d twig clusters pruned"),
+	       NumSegments, OutSkeleton.NumSegments(), Clusters.Num());
+}
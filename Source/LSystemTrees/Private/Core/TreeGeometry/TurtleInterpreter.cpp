@@ -4,15 +4,84 @@
 
 #include "Core/TreeGeometry/TurtleInterpreter.h"
 #include "Core/Utilities/TreeMath.h"
+#include "Core/Utilities/TreeStats.h"
 
 DEFINE_LOG_CATEGORY(LogTurtle);
 
+namespace
+{
+	/** Symbol -> turtle command, built once */
+	struct FTurtleCommandTable
+	{
+		ETurtleCommand Commands[256];
+
+		FTurtleCommandTable()
+		{
+			// Everything else (including rule variables such as X, Y, Z, A, B, G) has no turtle action
+			for (ETurtleCommand& Command : Commands)
+			{
+				Command = ETurtleCommand::None;
+			}
+
+			Commands['F'] = ETurtleCommand::Forward;
+			Commands['f'] = ETurtleCommand::Move;
+			Commands['+'] = ETurtleCommand::YawLeft;
+			Commands['-'] = ETurtleCommand::YawRight;
+			Commands['|'] = ETurtleCommand::TurnAround;
+			Commands['^'] = ETurtleCommand::PitchUp;
+			Commands['&'] = ETurtleCommand::PitchDown;
+			Commands['\\'] = ETurtleCommand::RollRight;
+			Commands['/'] = ETurtleCommand::RollLeft;
+			Commands['['] = ETurtleCommand::Push;
+			Commands[']'] = ETurtleCommand::Pop;
+			Commands['L'] = ETurtleCommand::Leaf;
+		}
+	};
+
+	const ETurtleCommand* GetCommandTable()
+	{
+		static const FTurtleCommandTable Table;
+		return Table.Commands;
+	}
+
+	/** Rotation axis of a command (consecutive commands about the same axis collapse into one rotation) */
+	enum class ETurtleAxis : uint8
+	{
+		None,
+		Up,
+		Left,
+		Forward
+	};
+
+	ETurtleAxis GetRotationAxis(ETurtleCommand Command)
+	{
+		switch (Command)
+		{
+		case ETurtleCommand::YawLeft:
+		case ETurtleCommand::YawRight:
+		case ETurtleCommand::TurnAround:
+			return ETurtleAxis::Up;
+		case ETurtleCommand::PitchUp:
+		case ETurtleCommand::PitchDown:
+			return ETurtleAxis::Left;
+		case ETurtleCommand::RollRight:
+		case ETurtleCommand::RollLeft:
+			return ETurtleAxis::Forward;
+		default:
+			return ETurtleAxis::None;
+		}
+	}
+}
+
 // ============================================================================
 // Constructor
 // ============================================================================
 
 UTurtleInterpreter::UTurtleInterpreter()
-	: MaxDepthReached(0)
+	: SkeletonOutput(nullptr)
+	, RotationsSinceReorthogonalize(0)
+	, bIncrementalValid(false)
+	, MaxDepthReached(0)
 	, SymbolsProcessed(0)
 {
 	RandomStream.Initialize(FMath::Rand());
@@ -27,9 +96,72 @@ void UTurtleInterpreter::InterpretString(const FString& LSystemString,
                                           TArray<FBranchSegment>& OutSegments,
                                           TArray<FLeafData>& OutLeaves)
 {
-	// Initialize
+	TRACE_CPUPROFILER_EVENT_SCOPE(Turtle::InterpretString);
+
+	// Non-ASCII characters are dropped; they never map to turtle commands
+	const FLSystemSymbolBuffer Symbols(LSystemString);
+	InterpretSymbols(Symbols, Config, OutSegments, OutLeaves);
+}
+
+void UTurtleInterpreter::InterpretSymbols(const FLSystemSymbolBuffer& Symbols,
+                                           const FTurtleConfig& Config,
+                                           TArray<FBranchSegment>& OutSegments,
+                                           TArray<FLeafData>& OutLeaves)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_Interpret);
+	TRACE_CPUPROFILER_EVENT_SCOPE(Turtle::InterpretSymbols);
+
+	UE_LOG(LogTurtle, Verbose, TEXT("Interpreting L-System string of length %d"), Symbols.Num());
+
+	FLSystemSymbolCounts Counts;
+	Counts.Accumulate(Symbols);
+
+	BeginStream(Config);
+	ReserveStateStack(Counts.MaxBracketDepth);
+	ProcessSymbols(Symbols.GetData(), Symbols.Num());
+	EndStream(OutSegments, OutLeaves);
+}
+
+void UTurtleInterpreter::InterpretSymbolsToSkeleton(const FLSystemSymbolBuffer& Symbols,
+                                                     const FTurtleConfig& Config,
+                                                     FTreeSkeleton& OutSkeleton)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LSystemTrees_Interpret);
+	TRACE_CPUPROFILER_EVENT_SCOPE(Turtle::InterpretSymbolsToSkeleton);
+
+	UE_LOG(LogTurtle, Verbose, TEXT("Interpreting L-System string of length %d into skeleton"), Symbols.Num());
+
+	// Every F may draw a segment and every L places a leaf, so the counts bound the output
+	FLSystemSymbolCounts Counts;
+	Counts.Accumulate(Symbols);
+	OutSkeleton.Reserve(Counts.Histogram[static_cast<uint8>('F')], Counts.Histogram[static_cast<uint8>('L')]);
+
+	BeginStream(Config, OutSkeleton);
+	ReserveStateStack(Counts.MaxBracketDepth);
+	ProcessSymbols(Symbols.GetData(), Symbols.Num());
+	EndStream();
+}
+
+TArray<FBranchSegment> UTurtleInterpreter::InterpretToSegments(const FString& LSystemString,
+                                                                const FTurtleConfig& Config)
+{
+	TArray<FBranchSegment> Segments;
+	TArray<FLeafData> Leaves;
+	InterpretString(LSystemString, Config, Segments, Leaves);
+	return Segments;
+}
+
+// ============================================================================
+// Streaming Interpretation
+// ============================================================================
+
+void UTurtleInterpreter::BeginStream(const FTurtleConfig& Config)
+{
+	// Initialize (this overwrites the output an incremental call would resume from)
 	Reset();
+	bIncrementalValid = false;
 	ActiveConfig = Config;
+	PrecomputeRotations();
 	InitializeState(Config);
 
 	// Initialize random stream
@@ -41,31 +173,209 @@ void UTurtleInterpreter::InterpretString(const FString& LSystemString,
 	{
 		RandomStream.Initialize(FMath::Rand());
 	}
+}
+
+void UTurtleInterpreter::BeginStream(const FTurtleConfig& Config, FTreeSkeleton& OutSkeleton)
+{
+	BeginStream(Config);
 
-	UE_LOG(LogTurtle, Verbose, TEXT("Interpreting L-System string of length %d"), LSystemString.Len());
+	OutSkeleton.Reset();
+	SkeletonOutput = &OutSkeleton;
+}
 
-	// Process each symbol
-	for (int32 i = 0; i < LSystemString.Len(); ++i)
+void UTurtleInterpreter::ReserveStateStack(int32 MaxBracketDepth)
+{
+	StateStack.Reserve(MaxBracketDepth);
+}
+
+void UTurtleInterpreter::ProcessSymbols(const uint8* Symbols, int32 Count)
+{
+	ProcessSymbolRange(Symbols, 0, Count, Count);
+}
+
+int32 UTurtleInterpreter::ProcessSymbolRange(const uint8* Symbols, int32 Start, int32 End, int32 RunLimit)
+{
+	const ETurtleCommand* CommandTable = GetCommandTable();
+
+	int32 i = Start;
+	while (i < End)
 	{
-		ProcessSymbol(LSystemString[i]);
-		SymbolsProcessed++;
+		const uint8 Symbol = Symbols[i];
+
+		// When skipping a branch, fast-forward to its closing ] (only brackets matter)
+		if (SkipBranchDepth > 0)
+		{
+			while (i < End && SkipBranchDepth > 0)
+			{
+				const uint8 Skipped = Symbols[i++];
+				SkipBranchDepth += (Skipped == '[') - (Skipped == ']');
+			}
+			continue;
+		}
+
+		const ETurtleCommand Command = CommandTable[Symbol];
+		if (GetRotationAxis(Command) != ETurtleAxis::None)
+		{
+			i = HandleRotationRun(Symbols, i, RunLimit);
+		}
+		else
+		{
+			ExecuteCommand(Command);
+			++i;
+		}
 	}
 
+	SymbolsProcessed += i - Start;
+	return i;
+}
+
+void UTurtleInterpreter::EndStream(TArray<FBranchSegment>& OutSegments, TArray<FLeafData>& OutLeaves)
+{
 	// Copy output
 	OutSegments = OutputSegments;
 	OutLeaves = OutputLeaves;
 
-	UE_LOG(LogTurtle, Log, TEXT("Interpretation complete: %d segments, %d leaves, max depth %d"),
-	       OutputSegments.Num(), OutputLeaves.Num(), MaxDepthReached);
+	UE_LOG(LogTurtle, Log, TEXT("Interpretation complete: %d symbols, %d segments, %d leaves, max depth %d"),
+	       SymbolsProcessed, OutputSegments.Num(), OutputLeaves.Num(), MaxDepthReached);
 }
 
-TArray<FBranchSegment> UTurtleInterpreter::InterpretToSegments(const FString& LSystemString,
-                                                                const FTurtleConfig& Config)
+void UTurtleInterpreter::EndStream()
 {
-	TArray<FBranchSegment> Segments;
-	TArray<FLeafData> Leaves;
-	InterpretString(LSystemString, Config, Segments, Leaves);
-	return Segments;
+	if (!SkeletonOutput)
+	{
+		UE_LOG(LogTurtle, Warning, TEXT("EndStream: no skeleton stream in progress"));
+		return;
+	}
+
+	UE_LOG(LogTurtle, Log, TEXT("Interpretation complete: %d symbols, %d segments, %d leaves, max depth %d"),
+	       SymbolsProcessed, SkeletonOutput->NumSegments(), SkeletonOutput->NumLeaves(), MaxDepthReached);
+
+	SkeletonOutput = nullptr;
+}
+
+// ============================================================================
+// Incremental Interpretation
+// ============================================================================
+
+int32 UTurtleInterpreter::InterpretSymbolsIncremental(const FLSystemSymbolBuffer& Symbols,
+                                                       const FTurtleConfig& Config,
+                                                       TArray<FBranchSegment>& OutSegments,
+                                                       TArray<FLeafData>& OutLeaves)
+{
+	const int32 NumSymbols = Symbols.Num();
+
+	// Find the last checkpoint inside the prefix shared with the previous call
+	int32 ResumeIndex = INDEX_NONE;
+	if (bIncrementalValid && FTurtleConfig::StaticStruct()->CompareScriptStruct(&Config, &IncrementalConfig, PPF_None))
+	{
+		const int32 MaxPrefix = FMath::Min(NumSymbols, IncrementalSymbols.Num());
+		const uint8* NewData = Symbols.GetData();
+		const uint8* OldData = IncrementalSymbols.GetData();
+
+		int32 CommonPrefix = 0;
+		while (CommonPrefix < MaxPrefix && NewData[CommonPrefix] == OldData[CommonPrefix])
+		{
+			++CommonPrefix;
+		}
+
+		if (CommonPrefix == NumSymbols && NumSymbols == IncrementalSymbols.Num())
+		{
+			// Unchanged input, the previous output still holds
+			OutSegments = OutputSegments;
+			OutLeaves = OutputLeaves;
+			return OutputSegments.Num();
+		}
+
+		// The symbol at a checkpoint ended the rotation run before it, so it has to be unchanged too
+		// (unless the new symbols end right there)
+		for (int32 i = Checkpoints.Num() - 1; i >= 0; --i)
+		{
+			const int32 CheckpointIndex = Checkpoints[i].SymbolIndex;
+			if (CheckpointIndex == 0 || CheckpointIndex < CommonPrefix ||
+			    (CheckpointIndex == CommonPrefix && CommonPrefix == NumSymbols))
+			{
+				ResumeIndex = i;
+				break;
+			}
+		}
+	}
+
+	int32 StartSymbol = 0;
+	int32 FirstChangedSegment = 0;
+
+	if (ResumeIndex != INDEX_NONE)
+	{
+		// Everything the checkpoint saw is unchanged: roll back to it and drop what came after
+		const FTurtleCheckpoint& Checkpoint = Checkpoints[ResumeIndex];
+		CurrentState = Checkpoint.State;
+		StateStack = Checkpoint.Stack;
+		RandomStream = Checkpoint.Stream;
+		SkipBranchDepth = Checkpoint.SkipBranchDepth;
+		RotationsSinceReorthogonalize = Checkpoint.RotationsSinceReorthogonalize;
+		MaxDepthReached = Checkpoint.MaxDepthReached;
+		OutputSegments.SetNum(Checkpoint.NumSegments);
+		OutputLeaves.SetNum(Checkpoint.NumLeaves);
+
+		StartSymbol = Checkpoint.SymbolIndex;
+		FirstChangedSegment = Checkpoint.NumSegments;
+		SymbolsProcessed = StartSymbol;
+
+		// Re-saved by ProcessSymbolsWithCheckpoints
+		Checkpoints.SetNum(ResumeIndex);
+
+		UE_LOG(LogTurtle, Verbose, TEXT("Incremental interpretation: resuming at symbol %d of %d (%d segments kept)"),
+		       StartSymbol, NumSymbols, FirstChangedSegment);
+	}
+	else
+	{
+		BeginStream(Config);
+		Checkpoints.Reset();
+	}
+
+	ProcessSymbolsWithCheckpoints(Symbols.GetData(), StartSymbol, NumSymbols);
+	EndStream(OutSegments, OutLeaves);
+
+	IncrementalSymbols = Symbols;
+	IncrementalConfig = Config;
+	bIncrementalValid = true;
+
+	return FirstChangedSegment;
+}
+
+void UTurtleInterpreter::ResetIncremental()
+{
+	Checkpoints.Reset();
+	IncrementalSymbols.Reset();
+	bIncrementalValid = false;
+}
+
+void UTurtleInterpreter::ProcessSymbolsWithCheckpoints(const uint8* Symbols, int32 Start, int32 End)
+{
+	// Start is 0 or a checkpoint being re-saved
+	int32 BlockStart = Start;
+	int32 NextCheckpoint = Start;
+	while (BlockStart < End)
+	{
+		if (BlockStart >= NextCheckpoint)
+		{
+			NextCheckpoint = (BlockStart / CheckpointInterval + 1) * CheckpointInterval;
+
+			FTurtleCheckpoint& Checkpoint = Checkpoints.AddDefaulted_GetRef();
+			Checkpoint.SymbolIndex = BlockStart;
+			Checkpoint.State = CurrentState;
+			Checkpoint.Stack = StateStack;
+			Checkpoint.Stream = RandomStream;
+			Checkpoint.SkipBranchDepth = SkipBranchDepth;
+			Checkpoint.RotationsSinceReorthogonalize = RotationsSinceReorthogonalize;
+			Checkpoint.MaxDepthReached = MaxDepthReached;
+			Checkpoint.NumSegments = OutputSegments.Num();
+			Checkpoint.NumLeaves = OutputLeaves.Num();
+		}
+
+		// Rotation runs are never split at a block end (their summed angle would round differently),
+		// so a block can end a few symbols late and its checkpoint moves along with it
+		BlockStart = ProcessSymbolRange(Symbols, BlockStart, FMath::Min(End, NextCheckpoint), End);
+	}
 }
 
 // ============================================================================
@@ -102,19 +412,27 @@ void UTurtleInterpreter::HandleForward(bool bDraw)
 	// Create segment if drawing
 	if (bDraw && StartWidth >= ActiveConfig.MinWidth)
 	{
-		FBranchSegment Segment;
-		Segment.StartPosition = StartPosition;
-		Segment.EndPosition = CurrentState.Position;
-		Segment.StartRadius = StartWidth;
-		Segment.EndRadius = EndWidth;
-		Segment.Direction = CurrentState.Forward;
-		Segment.Depth = CurrentState.Depth;
-		Segment.MaterialIndex = 0;
-		Segment.ParentSegmentIndex = CurrentState.LastSegmentIndex;
-
-		// Update last segment index before adding
-		CurrentState.LastSegmentIndex = OutputSegments.Num();
-		OutputSegments.Add(Segment);
+		if (SkeletonOutput)
+		{
+			CurrentState.LastSegmentIndex = SkeletonOutput->AddSegment(StartPosition, CurrentState.Position,
+				CurrentState.Forward, StartWidth, EndWidth, CurrentState.Depth, CurrentState.LastSegmentIndex);
+		}
+		else
+		{
+			FBranchSegment Segment;
+			Segment.StartPosition = StartPosition;
+			Segment.EndPosition = CurrentState.Position;
+			Segment.StartRadius = StartWidth;
+			Segment.EndRadius = EndWidth;
+			Segment.Direction = CurrentState.Forward;
+			Segment.Depth = CurrentState.Depth;
+			Segment.MaterialIndex = 0;
+			Segment.ParentSegmentIndex = CurrentState.LastSegmentIndex;
+
+			// Update last segment index before adding
+			CurrentState.LastSegmentIndex = OutputSegments.Num();
+			OutputSegments.Add(Segment);
+		}
 	}
 
 	// Update width for next segment
@@ -153,12 +471,9 @@ void UTurtleInterpreter::HandleRotateYaw(float AngleDegrees)
 	// Add random variation to angle
 	const float FinalAngle = AngleDegrees + GetRandomAngleVariation();
 
-	// Rotate Forward and Left around Up axis
-	CurrentState.Forward = RotateVector(CurrentState.Forward, CurrentState.Up, FinalAngle);
-	CurrentState.Left = RotateVector(CurrentState.Left, CurrentState.Up, FinalAngle);
-
-	// Ensure orthonormality
-	ReorthogonalizeBasis();
+	double Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(static_cast<double>(FinalAngle)));
+	ApplyYaw(Cos, Sin);
 }
 
 void UTurtleInterpreter::HandleRotatePitch(float AngleDegrees)
@@ -173,12 +488,9 @@ void UTurtleInterpreter::HandleRotatePitch(float AngleDegrees)
 	// Add pitch-specific random variation
 	const float FinalAngle = EffectiveAngle + GetRandomPitchVariation();
 
-	// Rotate Forward and Up around Left axis
-	CurrentState.Forward = RotateVector(CurrentState.Forward, CurrentState.Left, FinalAngle);
-	CurrentState.Up = RotateVector(CurrentState.Up, CurrentState.Left, FinalAngle);
-
-	// Ensure orthonormality
-	ReorthogonalizeBasis();
+	double Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(static_cast<double>(FinalAngle)));
+	ApplyPitch(Cos, Sin);
 }
 
 void UTurtleInterpreter::HandleRotateRoll(float AngleDegrees)
@@ -186,12 +498,126 @@ void UTurtleInterpreter::HandleRotateRoll(float AngleDegrees)
 	// Add random variation to angle
 	const float FinalAngle = AngleDegrees + GetRandomAngleVariation();
 
+	double Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(static_cast<double>(FinalAngle)));
+	ApplyRoll(Cos, Sin);
+}
+
+int32 UTurtleInterpreter::HandleRotationRun(const uint8* Symbols, int32 Start, int32 End)
+{
+	const ETurtleCommand* CommandTable = GetCommandTable();
+	const ETurtleCommand FirstCommand = CommandTable[Symbols[Start]];
+	const ETurtleAxis Axis = GetRotationAxis(FirstCommand);
+
+	// Sum the run's angles, drawing each symbol's variation in order so the random stream
+	// advances exactly as it would rotating one symbol at a time
+	double TotalAngle = 0.0;
+	int32 RunEnd = Start;
+	while (RunEnd < End)
+	{
+		const ETurtleCommand Command = CommandTable[Symbols[RunEnd]];
+		if (GetRotationAxis(Command) != Axis)
+		{
+			break;
+		}
+
+		float Angle = CommandRotations[static_cast<int32>(Command)].Angle;
+		if (Axis == ETurtleAxis::Left)
+		{
+			if (ShouldFlipPitch())
+			{
+				Angle = -Angle;
+			}
+			Angle += GetRandomPitchVariation();
+		}
+		else
+		{
+			Angle += GetRandomAngleVariation();
+		}
+
+		TotalAngle += Angle;
+		++RunEnd;
+	}
+
+	// A lone symbol without variation uses its precomputed rotation
+	const FTurtleRotation& Fixed = CommandRotations[static_cast<int32>(FirstCommand)];
+	double Sin = Fixed.Sin;
+	double Cos = Fixed.Cos;
+	if (RunEnd - Start > 1 || TotalAngle != Fixed.Angle)
+	{
+		FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(TotalAngle));
+	}
+
+	switch (Axis)
+	{
+	case ETurtleAxis::Up:
+		ApplyYaw(Cos, Sin);
+		break;
+	case ETurtleAxis::Left:
+		ApplyPitch(Cos, Sin);
+		break;
+	default:
+		ApplyRoll(Cos, Sin);
+		break;
+	}
+
+	return RunEnd;
+}
+
+void UTurtleInterpreter::ApplyYaw(double Cos, double Sin)
+{
+	// Rotate Forward and Left around Up axis (Up = Forward x Left, so this is Rodrigues' formula
+	// with the cross products already known)
+	const FVector Forward = CurrentState.Forward;
+	CurrentState.Forward = Forward * Cos + CurrentState.Left * Sin;
+	CurrentState.Left = CurrentState.Left * Cos - Forward * Sin;
+	OnBasisRotated();
+}
+
+void UTurtleInterpreter::ApplyPitch(double Cos, double Sin)
+{
+	// Rotate Forward and Up around Left axis
+	const FVector Forward = CurrentState.Forward;
+	CurrentState.Forward = Forward * Cos - CurrentState.Up * Sin;
+	CurrentState.Up = CurrentState.Up * Cos + Forward * Sin;
+	OnBasisRotated();
+}
+
+void UTurtleInterpreter::ApplyRoll(double Cos, double Sin)
+{
 	// Rotate Left and Up around Forward axis
-	CurrentState.Left = RotateVector(CurrentState.Left, CurrentState.Forward, FinalAngle);
-	CurrentState.Up = RotateVector(CurrentState.Up, CurrentState.Forward, FinalAngle);
+	const FVector Left = CurrentState.Left;
+	CurrentState.Left = Left * Cos + CurrentState.Up * Sin;
+	CurrentState.Up = CurrentState.Up * Cos - Left * Sin;
+	OnBasisRotated();
+}
 
-	// Ensure orthonormality
-	ReorthogonalizeBasis();
+void UTurtleInterpreter::OnBasisRotated()
+{
+	// A rotation of an orthonormal basis keeps it orthonormal up to rounding, so drift only
+	// needs correcting now and then
+	if (++RotationsSinceReorthogonalize >= ReorthogonalizeInterval)
+	{
+		ReorthogonalizeBasis();
+	}
+}
+
+void UTurtleInterpreter::PrecomputeRotations()
+{
+	auto SetRotation = [this](ETurtleCommand Command, float Angle)
+	{
+		FTurtleRotation& Rotation = CommandRotations[static_cast<int32>(Command)];
+		Rotation.Angle = Angle;
+		FMath::SinCos(&Rotation.Sin, &Rotation.Cos, FMath::DegreesToRadians(static_cast<double>(Angle)));
+	};
+
+	SetRotation(ETurtleCommand::YawLeft, ActiveConfig.DefaultAngle);
+	SetRotation(ETurtleCommand::YawRight, -ActiveConfig.DefaultAngle);
+	SetRotation(ETurtleCommand::TurnAround, 180.0f);
+	SetRotation(ETurtleCommand::PitchUp, ActiveConfig.PitchAngle);
+	SetRotation(ETurtleCommand::PitchDown, -ActiveConfig.PitchAngle);
+	SetRotation(ETurtleCommand::RollRight, ActiveConfig.RollAngle);
+	SetRotation(ETurtleCommand::RollLeft, -ActiveConfig.RollAngle);
 }
 
 void UTurtleInterpreter::HandlePushState()
@@ -217,8 +643,13 @@ void UTurtleInterpreter::HandlePushState()
 		}
 	}
 
-	// Save current state
-	StateStack.Push(CurrentState);
+	// Save the part of the state the branch may change
+	FTurtleStackEntry& Entry = StateStack.AddDefaulted_GetRef();
+	Entry.Position = CurrentState.Position;
+	Entry.Forward = CurrentState.Forward;
+	Entry.Left = CurrentState.Left;
+	Entry.CurrentWidth = CurrentState.CurrentWidth;
+	Entry.LastSegmentIndex = CurrentState.LastSegmentIndex;
 
 	// Increase depth
 	CurrentState.Depth++;
@@ -245,7 +676,15 @@ void UTurtleInterpreter::HandlePopState()
 
 	if (StateStack.Num() > 0)
 	{
-		CurrentState = StateStack.Pop();
+		const FTurtleStackEntry& Entry = StateStack.Last();
+		CurrentState.Position = Entry.Position;
+		CurrentState.Forward = Entry.Forward;
+		CurrentState.Left = Entry.Left;
+		CurrentState.Up = FVector::CrossProduct(Entry.Forward, Entry.Left);
+		CurrentState.CurrentWidth = Entry.CurrentWidth;
+		CurrentState.LastSegmentIndex = Entry.LastSegmentIndex;
+		CurrentState.Depth--;
+		StateStack.Pop(false);
 
 		UE_LOG(LogTurtle, Verbose, TEXT("Pop state: depth now %d, position (%.1f, %.1f, %.1f)"),
 		       CurrentState.Depth, CurrentState.Position.X, CurrentState.Position.Y, CurrentState.Position.Z);
@@ -264,6 +703,17 @@ void UTurtleInterpreter::HandleTurnAround()
 
 void UTurtleInterpreter::HandlePlaceLeaf()
 {
+	// Add random rotation (drawn first so both output forms consume the stream identically)
+	const float Rotation = RandomStream.FRandRange(-30.0f, 30.0f);
+
+	if (SkeletonOutput)
+	{
+		// Leaf faces forward direction
+		SkeletonOutput->AddLeaf(CurrentState.Position, CurrentState.Forward, CurrentState.Up,
+		                        ActiveConfig.LeafSize, Rotation, CurrentState.Depth);
+		return;
+	}
+
 	// Create leaf at current position
 	FLeafData Leaf;
 	Leaf.Position = CurrentState.Position;
@@ -271,9 +721,7 @@ void UTurtleInterpreter::HandlePlaceLeaf()
 	Leaf.UpDirection = CurrentState.Up;
 	Leaf.Size = ActiveConfig.LeafSize;
 	Leaf.Depth = CurrentState.Depth;
-
-	// Add random rotation
-	Leaf.Rotation = RandomStream.FRandRange(-30.0f, 30.0f);
+	Leaf.Rotation = Rotation;
 
 	OutputLeaves.Add(Leaf);
 
@@ -322,12 +770,16 @@ void UTurtleInterpreter::InitializeState(const FTurtleConfig& Config)
 void UTurtleInterpreter::Reset()
 {
 	CurrentState = FTurtleState();
-	StateStack.Empty();
-	OutputSegments.Empty();
-	OutputLeaves.Empty();
+	StateStack.Reset();
+
+	// Keep the allocations, the next interpretation usually produces a similar amount of output
+	OutputSegments.Reset();
+	OutputLeaves.Reset();
 	MaxDepthReached = 0;
 	SymbolsProcessed = 0;
 	SkipBranchDepth = 0;
+	RotationsSinceReorthogonalize = 0;
+	SkeletonOutput = nullptr;
 }
 
 void UTurtleInterpreter::ApplyTropism()
@@ -378,6 +830,8 @@ void UTurtleInterpreter::ApplyTropism()
 
 void UTurtleInterpreter::ReorthogonalizeBasis()
 {
+	RotationsSinceReorthogonalize = 0;
+
 	// Normalize forward
 	CurrentState.Forward = CurrentState.Forward.GetSafeNormal();
 
@@ -421,89 +875,33 @@ FVector UTurtleInterpreter::RotateVector(const FVector& Vector, const FVector& A
 	       K * FVector::DotProduct(K, Vector) * (1.0f - CosAngle);
 }
 
-void UTurtleInterpreter::ProcessSymbol(TCHAR Symbol)
+void UTurtleInterpreter::ExecuteCommand(ETurtleCommand Command)
 {
-	// When skipping a branch, only process [ and ] to track depth
-	if (SkipBranchDepth > 0)
-	{
-		if (Symbol == TEXT('['))
-		{
-			SkipBranchDepth++;
-		}
-		else if (Symbol == TEXT(']'))
-		{
-			SkipBranchDepth--;
-		}
-		// Skip all other symbols
-		return;
-	}
-
-	switch (Symbol)
+	switch (Command)
 	{
 	// Movement
-	case TEXT('F'):
+	case ETurtleCommand::Forward:
 		HandleForward(true);
 		break;
-	case TEXT('f'):
+	case ETurtleCommand::Move:
 		HandleForward(false);
 		break;
 
-	// Yaw (rotation around Up)
-	case TEXT('+'):
-		HandleRotateYaw(ActiveConfig.DefaultAngle);
-		break;
-	case TEXT('-'):
-		HandleRotateYaw(-ActiveConfig.DefaultAngle);
-		break;
-
-	// Pitch (rotation around Left)
-	case TEXT('^'):
-		HandleRotatePitch(ActiveConfig.PitchAngle);
-		break;
-	case TEXT('&'):
-		HandleRotatePitch(-ActiveConfig.PitchAngle);
-		break;
-
-	// Roll (rotation around Forward)
-	case TEXT('\\'):
-		HandleRotateRoll(ActiveConfig.RollAngle);
-		break;
-	case TEXT('/'):
-		HandleRotateRoll(-ActiveConfig.RollAngle);
-		break;
-
-	// Turn around
-	case TEXT('|'):
-		HandleTurnAround();
-		break;
-
 	// Branching
-	case TEXT('['):
+	case ETurtleCommand::Push:
 		HandlePushState();
 		break;
-	case TEXT(']'):
+	case ETurtleCommand::Pop:
 		HandlePopState();
 		break;
 
 	// Leaves
-	case TEXT('L'):
+	case ETurtleCommand::Leaf:
 		HandlePlaceLeaf();
 		break;
 
-	// Ignored symbols (placeholders in L-System rules)
-	case TEXT('X'):
-	case TEXT('Y'):
-	case TEXT('Z'):
-	case TEXT('A'):
-	case TEXT('B'):
-	case TEXT('G'):
-		// These are often used as variables in L-System rules
-		// and don't produce any turtle action
-		break;
-
 	default:
-		// Unknown symbol - ignore silently
-		// Many L-System strings contain symbols that don't map to turtle actions
+		// No turtle action (rule variables and unknown symbols), rotations are handled as runs
 		break;
 	}
 }
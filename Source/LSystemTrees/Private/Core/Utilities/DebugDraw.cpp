@@ -3,8 +3,332 @@
 // Part of LSystemTrees Plugin - Phase 3
 
 #include "Core/Utilities/DebugDraw.h"
-#include "DrawDebugHelpers.h"
+#include "Core/Utilities/TreeMath.h"
+#include "Components/LineBatchComponent.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarDebugDrawMaxLines(
+	TEXT("LSystemTrees.DebugDraw.MaxLines"),
+	100000,
+	TEXT("Maximum number of lines a single tree debug draw submits. Larger trees are decimated ")
+	TEXT("(tips first for branches, strided otherwise). 0 = unlimited."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDebugDrawMinScreenSize(
+	TEXT("LSystemTrees.DebugDraw.MinScreenSize"),
+	0.002f,
+	TEXT("Debug elements smaller than this screen size (from the nearest view rendered last frame) are skipped.\n")
+	TEXT("0 draws everything regardless of distance."),
+	ECVF_Default);
+
+namespace
+{
+	/** Sides of the radius circles drawn at branch joints */
+	constexpr int32 DebugCircleSides = 16;
+
+	/** Lines drawn per leaf (normal + quad outline) */
+	constexpr int32 DebugLinesPerLeaf = 5;
+
+	/**
+	 * Lines and points collected for one submission to the world's line batcher.
+	 * Submitting once avoids the per-line render state update of DrawDebugLine.
+	 */
+	class FDebugLineBatch
+	{
+	public:
+		FDebugLineBatch(UWorld* World, float Duration)
+			: LineBatcher(nullptr)
+			, LifeTime(Duration)
+			, MaxLines(UTreeDebugDraw::GetMaxDebugLines())
+			, MinScreenSize(FMath::Max(0.0f, CVarDebugDrawMinScreenSize.GetValueOnGameThread()))
+			, NumDropped(0)
+		{
+			if (World->GetNetMode() == NM_DedicatedServer)
+			{
+				return;
+			}
+
+			// Same batcher and lifetime DrawDebugLine picks for non-persistent lines
+			LineBatcher = Duration > 0.0f ? World->PersistentLineBatcher : World->LineBatcher;
+			if (LineBatcher && Duration <= 0.0f)
+			{
+				LifeTime = LineBatcher->DefaultLifeTime;
+			}
+
+			if (MinScreenSize > 0.0f)
+			{
+				ViewLocations = World->ViewLocationsRenderedLastFrame;
+			}
+		}
+
+		bool IsValid() const
+		{
+			return LineBatcher != nullptr;
+		}
+
+		/** Lines left before the cap */
+		int32 GetRemainingLines() const
+		{
+			return MaxLines > 0 ? FMath::Max(0, MaxLines - Lines.Num()) : MAX_int32;
+		}
+
+		/** Whether an element is large enough on screen to be worth drawing */
+		bool IsVisible(const FVector& Center, float Radius) const
+		{
+			if (ViewLocations.Num() == 0)
+			{
+				return true;
+			}
+
+			float MinDistanceSquared = MAX_flt;
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(Center, ViewLocation)));
+			}
+
+			return UTreeMath::ComputeScreenSize(Radius, FMath::Sqrt(MinDistanceSquared)) >= MinScreenSize;
+		}
+
+		/**
+		 * Stride that fits Count elements into the remaining budget.
+		 * @return 1 if all fit, 0 if none fit
+		 */
+		int32 GetStride(int32 Count, int32 LinesPerElement) const
+		{
+			const int32 Fit = GetRemainingLines() / FMath::Max(1, LinesPerElement);
+			if (Count <= Fit)
+			{
+				return 1;
+			}
+			return Fit > 0 ? FMath::DivideAndRoundUp(Count, Fit) : 0;
+		}
+
+		void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness)
+		{
+			if (MaxLines > 0 && Lines.Num() >= MaxLines)
+			{
+				++NumDropped;
+				return;
+			}
+			Lines.Emplace(Start, End, FLinearColor(Color), LifeTime, Thickness, SDPG_World);
+		}
+
+		void AddCircle(const FVector& Center, float Radius, const FVector& YAxis, const FVector& ZAxis, const FColor& Color)
+		{
+			const float AngleStep = 2.0f * PI / DebugCircleSides;
+			FVector Previous = Center + YAxis * Radius;
+			for (int32 Side = 1; Side <= DebugCircleSides; ++Side)
+			{
+				float Sin, Cos;
+				FMath::SinCos(&Sin, &Cos, AngleStep * Side);
+				const FVector Next = Center + (YAxis * Cos + ZAxis * Sin) * Radius;
+				AddLine(Previous, Next, Color, 1.0f);
+				Previous = Next;
+			}
+		}
+
+		void AddPoint(const FVector& Position, const FColor& Color, float Size)
+		{
+			if (MaxLines > 0 && Points.Num() >= MaxLines)
+			{
+				return;
+			}
+			Points.Emplace(Position, FLinearColor(Color), Size, LifeTime, SDPG_World);
+		}
+
+		/** Hand everything to the line batcher in one call */
+		void Submit()
+		{
+			if (!LineBatcher)
+			{
+				return;
+			}
+
+			if (Lines.Num() > 0)
+			{
+				LineBatcher->DrawLines(Lines);
+			}
+
+			if (Points.Num() > 0)
+			{
+				LineBatcher->BatchedPoints.Append(Points);
+				LineBatcher->MarkRenderStateDirty();
+			}
+
+			if (NumDropped > 0)
+			{
+				UE_LOG(LogTemp, Verbose, TEXT("TreeDebugDraw: Dropped %d lines over the LSystemTrees.DebugDraw.MaxLines cap"), NumDropped);
+			}
+		}
+
+	private:
+		ULineBatchComponent* LineBatcher;
+		float LifeTime;
+		int32 MaxLines;
+		float MinScreenSize;
+		int32 NumDropped;
+
+		TArray<FVector> ViewLocations;
+		TArray<FBatchedLine> Lines;
+		TArray<FBatchedPoint> Points;
+	};
+
+	/** One branch segment read from either FBranchSegment arrays or a skeleton */
+	struct FDebugSegment
+	{
+		FVector Start;
+		FVector End;
+		float StartRadius;
+		float EndRadius;
+		int32 Depth;
+	};
+
+	bool IsSegmentVisible(const FDebugLineBatch& Batch, const FDebugSegment& Segment)
+	{
+		const float HalfLength = static_cast<float>(FVector::Dist(Segment.Start, Segment.End)) * 0.5f;
+		return Batch.IsVisible((Segment.Start + Segment.End) * 0.5f, FMath::Max(HalfLength, Segment.StartRadius));
+	}
+
+	/**
+	 * Batch branch segments colored by depth. Segments too small on screen are skipped, then
+	 * depths are dropped from the tips inward until the rest fits the line budget.
+	 */
+	template<typename GetSegmentType>
+	void BatchBranchSegments(FDebugLineBatch& Batch, int32 NumSegments, bool bShowRadius, GetSegmentType&& GetSegment)
+	{
+		const int32 LinesPerSegment = 1 + (bShowRadius ? 2 * DebugCircleSides : 0);
+
+		// Count visible segments per depth (and the overall max depth for color normalization)
+		int32 MaxDepth = 0;
+		TArray<int32> SegmentsPerDepth;
+		for (int32 i = 0; i < NumSegments; ++i)
+		{
+			const FDebugSegment Segment = GetSegment(i);
+			MaxDepth = FMath::Max(MaxDepth, Segment.Depth);
+
+			if (IsSegmentVisible(Batch, Segment))
+			{
+				if (Segment.Depth >= SegmentsPerDepth.Num())
+				{
+					SegmentsPerDepth.SetNumZeroed(Segment.Depth + 1);
+				}
+				++SegmentsPerDepth[Segment.Depth];
+			}
+		}
+
+		int32 Stride = 1;
+		const int32 FullDepths = UTreeDebugDraw::GetDecimationDepth(SegmentsPerDepth, LinesPerSegment,
+		                                                            Batch.GetRemainingLines(), Stride);
+
+		int32 StridedIndex = 0;
+		for (int32 i = 0; i < NumSegments; ++i)
+		{
+			const FDebugSegment Segment = GetSegment(i);
+			if (Segment.Depth > FullDepths || !IsSegmentVisible(Batch, Segment))
+			{
+				continue;
+			}
+
+			if (Segment.Depth == FullDepths && (Stride <= 0 || (StridedIndex++ % Stride) != 0))
+			{
+				continue;
+			}
+
+			const FColor Color = UTreeDebugDraw::GetDepthColor(Segment.Depth, MaxDepth).ToFColor(true);
+
+			// Main segment line with thickness based on radius
+			const float Thickness = FMath::Max(1.0f, Segment.StartRadius * 0.5f);
+			Batch.AddLine(Segment.Start, Segment.End, Color, Thickness);
+
+			// Optionally radius circles at joints
+			if (bShowRadius)
+			{
+				Batch.AddCircle(Segment.Start, Segment.StartRadius, FVector::RightVector, FVector::ForwardVector, Color);
+				Batch.AddCircle(Segment.End, Segment.EndRadius, FVector::RightVector, FVector::ForwardVector, Color);
+			}
+		}
+	}
+
+	/** Batch one leaf as a point, its normal and a quad outline */
+	void BatchLeaf(FDebugLineBatch& Batch, const FVector& Position, const FVector& Normal,
+	               const FVector& UpDirection, const FVector2D& Size)
+	{
+		const FColor LeafColor = FColor::Green;
+		const float NormalLength = 10.0f;
+
+		// Leaf position as a point
+		Batch.AddPoint(Position, LeafColor, 8.0f);
+
+		// Leaf normal
+		Batch.AddLine(Position, Position + Normal * NormalLength, FColor::Cyan, 1.0f);
+
+		// A small quad outline representing the leaf
+		FVector Right, Up;
+		Up = UpDirection - Normal * FVector::DotProduct(UpDirection, Normal);
+		if (Up.IsNearlyZero())
+		{
+			if (FMath::Abs(Normal.Z) < 0.9f)
+			{
+				Up = FVector::CrossProduct(Normal, FVector::UpVector).GetSafeNormal();
+				Up = FVector::CrossProduct(Up, Normal);
+			}
+			else
+			{
+				Up = FVector::CrossProduct(Normal, FVector::ForwardVector).GetSafeNormal();
+				Up = FVector::CrossProduct(Up, Normal);
+			}
+		}
+		Up.Normalize();
+		Right = FVector::CrossProduct(Normal, Up).GetSafeNormal();
+
+		const float HalfWidth = Size.X * 0.5f;
+		const float HalfHeight = Size.Y * 0.5f;
+
+		// Quad corners
+		const FVector BL = Position - Right * HalfWidth - Up * HalfHeight;
+		const FVector BR = Position + Right * HalfWidth - Up * HalfHeight;
+		const FVector TR = Position + Right * HalfWidth + Up * HalfHeight;
+		const FVector TL = Position - Right * HalfWidth + Up * HalfHeight;
+
+		Batch.AddLine(BL, BR, LeafColor, 1.0f);
+		Batch.AddLine(BR, TR, LeafColor, 1.0f);
+		Batch.AddLine(TR, TL, LeafColor, 1.0f);
+		Batch.AddLine(TL, BL, LeafColor, 1.0f);
+	}
+
+	/** Batch every Nth visible leaf so all of them fit the remaining budget */
+	template<typename IsLeafVisibleType, typename DrawLeafType>
+	void BatchLeaves(FDebugLineBatch& Batch, int32 NumLeaves, IsLeafVisibleType&& IsLeafVisible, DrawLeafType&& DrawLeaf)
+	{
+		int32 NumVisible = 0;
+		for (int32 i = 0; i < NumLeaves; ++i)
+		{
+			NumVisible += IsLeafVisible(i) ? 1 : 0;
+		}
+
+		const int32 Stride = Batch.GetStride(NumVisible, DebugLinesPerLeaf);
+		if (Stride <= 0)
+		{
+			return;
+		}
+
+		int32 VisibleIndex = 0;
+		for (int32 i = 0; i < NumLeaves; ++i)
+		{
+			if (IsLeafVisible(i) && (VisibleIndex++ % Stride) == 0)
+			{
+				DrawLeaf(i);
+			}
+		}
+	}
+
+	/** World from a context object, or null if drawing is not possible */
+	UWorld* GetDebugWorld(const UObject* WorldContext)
+	{
+		return WorldContext ? WorldContext->GetWorld() : nullptr;
+	}
+}
 
 // ============================================================================
 // Branch Visualization
@@ -15,49 +339,28 @@ void UTreeDebugDraw::DrawBranchSegments(const UObject* WorldContext,
                                          float Duration,
                                          bool bShowRadius)
 {
-	if (!WorldContext)
-	{
-		return;
-	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawBranchSegments);
 
-	UWorld* World = WorldContext->GetWorld();
+	UWorld* World = GetDebugWorld(WorldContext);
 	if (!World)
 	{
 		return;
 	}
 
-	// Find max depth for color normalization
-	int32 MaxDepth = 0;
-	for (const FBranchSegment& Segment : Segments)
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
 	{
-		MaxDepth = FMath::Max(MaxDepth, Segment.Depth);
+		return;
 	}
 
-	// Draw each segment
-	for (const FBranchSegment& Segment : Segments)
+	BatchBranchSegments(Batch, Segments.Num(), bShowRadius, [&Segments](int32 Index)
 	{
-		const FLinearColor LinearColor = GetDepthColor(Segment.Depth, MaxDepth);
-		const FColor Color = LinearColor.ToFColor(true);
-
-		// Draw main segment line with thickness based on radius
-		const float Thickness = FMath::Max(1.0f, Segment.StartRadius * 0.5f);
-		DrawDebugLine(World, Segment.StartPosition, Segment.EndPosition,
-		              Color, false, Duration, 0, Thickness);
+		const FBranchSegment& Segment = Segments[Index];
+		return FDebugSegment{ Segment.StartPosition, Segment.EndPosition,
+		                      Segment.StartRadius, Segment.EndRadius, FMath::Max(0, Segment.Depth) };
+	});
 
-		// Optionally draw radius circles at joints
-		if (bShowRadius)
-		{
-			// Draw circle at start
-			DrawDebugCircle(World, Segment.StartPosition, Segment.StartRadius,
-			                16, Color, false, Duration, 0, 1.0f,
-			                FVector::RightVector, FVector::ForwardVector, false);
-
-			// Draw circle at end
-			DrawDebugCircle(World, Segment.EndPosition, Segment.EndRadius,
-			                16, Color, false, Duration, 0, 1.0f,
-			                FVector::RightVector, FVector::ForwardVector, false);
-		}
-	}
+	Batch.Submit();
 }
 
 void UTreeDebugDraw::DrawTurtlePath(const UObject* WorldContext,
@@ -65,24 +368,50 @@ void UTreeDebugDraw::DrawTurtlePath(const UObject* WorldContext,
                                      bool bShowOrientation,
                                      float Duration)
 {
-	if (!WorldContext)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawTurtlePath);
+
+	UWorld* World = GetDebugWorld(WorldContext);
+	if (!World)
 	{
 		return;
 	}
 
-	UWorld* World = WorldContext->GetWorld();
-	if (!World)
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
 	{
 		return;
 	}
 
 	const float OrientationLength = 5.0f;
 
+	auto IsVisible = [&Batch](const FBranchSegment& Segment)
+	{
+		return Batch.IsVisible((Segment.StartPosition + Segment.EndPosition) * 0.5f,
+		                       static_cast<float>(FVector::Dist(Segment.StartPosition, Segment.EndPosition)) * 0.5f);
+	};
+
+	int32 NumVisible = 0;
+	for (const FBranchSegment& Segment : Segments)
+	{
+		NumVisible += IsVisible(Segment) ? 1 : 0;
+	}
+
+	const int32 Stride = Batch.GetStride(NumVisible, bShowOrientation ? 4 : 1);
+	if (Stride <= 0)
+	{
+		return;
+	}
+
+	int32 VisibleIndex = 0;
 	for (const FBranchSegment& Segment : Segments)
 	{
+		if (!IsVisible(Segment) || (VisibleIndex++ % Stride) != 0)
+		{
+			continue;
+		}
+
 		// Draw segment in white
-		DrawDebugLine(World, Segment.StartPosition, Segment.EndPosition,
-		              FColor::White, false, Duration, 0, 1.0f);
+		Batch.AddLine(Segment.StartPosition, Segment.EndPosition, FColor::White, 1.0f);
 
 		// Draw orientation vectors at start of each segment
 		if (bShowOrientation)
@@ -103,84 +432,104 @@ void UTreeDebugDraw::DrawTurtlePath(const UObject* WorldContext,
 			Up = FVector::CrossProduct(Forward, Left).GetSafeNormal();
 
 			// Forward = Red
-			DrawDebugLine(World, Pos, Pos + Forward * OrientationLength,
-			              FColor::Red, false, Duration, 0, 2.0f);
+			Batch.AddLine(Pos, Pos + Forward * OrientationLength, FColor::Red, 2.0f);
 
 			// Left = Green
-			DrawDebugLine(World, Pos, Pos + Left * OrientationLength,
-			              FColor::Green, false, Duration, 0, 2.0f);
+			Batch.AddLine(Pos, Pos + Left * OrientationLength, FColor::Green, 2.0f);
 
 			// Up = Blue
-			DrawDebugLine(World, Pos, Pos + Up * OrientationLength,
-			              FColor::Blue, false, Duration, 0, 2.0f);
+			Batch.AddLine(Pos, Pos + Up * OrientationLength, FColor::Blue, 2.0f);
 		}
 
 		// Draw point at segment start
-		DrawDebugPoint(World, Segment.StartPosition, 5.0f, FColor::Yellow, false, Duration);
+		Batch.AddPoint(Segment.StartPosition, FColor::Yellow, 5.0f);
 	}
+
+	Batch.Submit();
 }
 
 void UTreeDebugDraw::DrawLeaves(const UObject* WorldContext,
                                  const TArray<FLeafData>& Leaves,
                                  float Duration)
 {
-	if (!WorldContext)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawLeaves);
+
+	UWorld* World = GetDebugWorld(WorldContext);
+	if (!World)
 	{
 		return;
 	}
 
-	UWorld* World = WorldContext->GetWorld();
-	if (!World)
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
 	{
 		return;
 	}
 
-	const FColor LeafColor = FColor::Green;
-	const float NormalLength = 10.0f;
+	BatchLeaves(Batch, Leaves.Num(),
+		[&Batch, &Leaves](int32 Index)
+		{
+			return Batch.IsVisible(Leaves[Index].Position, static_cast<float>(Leaves[Index].Size.GetMax()) * 0.5f);
+		},
+		[&Batch, &Leaves](int32 Index)
+		{
+			const FLeafData& Leaf = Leaves[Index];
+			BatchLeaf(Batch, Leaf.Position, Leaf.Normal, Leaf.UpDirection, Leaf.Size);
+		});
 
-	for (const FLeafData& Leaf : Leaves)
-	{
-		// Draw leaf position as a point
-		DrawDebugPoint(World, Leaf.Position, 8.0f, LeafColor, false, Duration);
+	Batch.Submit();
+}
 
-		// Draw leaf normal
-		DrawDebugLine(World, Leaf.Position, Leaf.Position + Leaf.Normal * NormalLength,
-		              FColor::Cyan, false, Duration, 0, 1.0f);
+void UTreeDebugDraw::DrawSkeleton(const UObject* WorldContext,
+                                   const FTreeSkeleton& Skeleton,
+                                   const FTransform& Transform,
+                                   float Duration,
+                                   bool bShowRadius,
+                                   bool bShowLeaves)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawSkeleton);
 
-		// Draw a small quad outline representing the leaf
-		FVector Right, Up;
-		Up = Leaf.UpDirection - Leaf.Normal * FVector::DotProduct(Leaf.UpDirection, Leaf.Normal);
-		if (Up.IsNearlyZero())
-		{
-			if (FMath::Abs(Leaf.Normal.Z) < 0.9f)
-			{
-				Up = FVector::CrossProduct(Leaf.Normal, FVector::UpVector).GetSafeNormal();
-				Up = FVector::CrossProduct(Up, Leaf.Normal);
-			}
-			else
-			{
-				Up = FVector::CrossProduct(Leaf.Normal, FVector::ForwardVector).GetSafeNormal();
-				Up = FVector::CrossProduct(Up, Leaf.Normal);
-			}
-		}
-		Up.Normalize();
-		Right = FVector::CrossProduct(Leaf.Normal, Up).GetSafeNormal();
+	UWorld* World = GetDebugWorld(WorldContext);
+	if (!World)
+	{
+		return;
+	}
+
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
+	{
+		return;
+	}
 
-		const float HalfWidth = Leaf.Size.X * 0.5f;
-		const float HalfHeight = Leaf.Size.Y * 0.5f;
+	const float RadiusScale = static_cast<float>(Transform.GetMaximumAxisScale());
 
-		// Quad corners
-		const FVector BL = Leaf.Position - Right * HalfWidth - Up * HalfHeight;
-		const FVector BR = Leaf.Position + Right * HalfWidth - Up * HalfHeight;
-		const FVector TR = Leaf.Position + Right * HalfWidth + Up * HalfHeight;
-		const FVector TL = Leaf.Position - Right * HalfWidth + Up * HalfHeight;
+	BatchBranchSegments(Batch, Skeleton.NumSegments(), bShowRadius, [&Skeleton, &Transform, RadiusScale](int32 Index)
+	{
+		return FDebugSegment{ Transform.TransformPosition(FVector(Skeleton.SegmentStarts[Index])),
+		                      Transform.TransformPosition(FVector(Skeleton.SegmentEnds[Index])),
+		                      Skeleton.StartRadii[Index] * RadiusScale, Skeleton.EndRadii[Index] * RadiusScale,
+		                      static_cast<int32>(Skeleton.SegmentDepths[Index]) };
+	});
 
-		// Draw quad outline
-		DrawDebugLine(World, BL, BR, LeafColor, false, Duration, 0, 1.0f);
-		DrawDebugLine(World, BR, TR, LeafColor, false, Duration, 0, 1.0f);
-		DrawDebugLine(World, TR, TL, LeafColor, false, Duration, 0, 1.0f);
-		DrawDebugLine(World, TL, BL, LeafColor, false, Duration, 0, 1.0f);
+	if (bShowLeaves)
+	{
+		BatchLeaves(Batch, Skeleton.NumLeaves(),
+			[&Batch, &Skeleton, &Transform, RadiusScale](int32 Index)
+			{
+				return Batch.IsVisible(Transform.TransformPosition(FVector(Skeleton.LeafPositions[Index])),
+				                       Skeleton.LeafSizes[Index].GetMax() * 0.5f * RadiusScale);
+			},
+			[&Batch, &Skeleton, &Transform, RadiusScale](int32 Index)
+			{
+				BatchLeaf(Batch,
+				          Transform.TransformPosition(FVector(Skeleton.LeafPositions[Index])),
+				          Transform.TransformVectorNoScale(FVector(Skeleton.LeafNormals[Index])),
+				          Transform.TransformVectorNoScale(FVector(Skeleton.LeafUps[Index])),
+				          FVector2D(Skeleton.LeafSizes[Index]) * RadiusScale);
+			});
 	}
+
+	Batch.Submit();
 }
 
 // ============================================================================
@@ -268,46 +617,87 @@ void UTreeDebugDraw::DrawMeshWireframe(const UObject* WorldContext,
                                         const FTransform& Transform,
                                         float Duration)
 {
-	if (!WorldContext)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawMeshWireframe);
+
+	UWorld* World = GetDebugWorld(WorldContext);
+	if (!World)
 	{
 		return;
 	}
 
-	UWorld* World = WorldContext->GetWorld();
-	if (!World)
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
 	{
 		return;
 	}
 
 	const FColor WireColor = FColor::Cyan;
 
-	// Draw each triangle as wireframe
-	const int32 NumTriangles = MeshData.Triangles.Num() / 3;
-	for (int32 i = 0; i < NumTriangles; ++i)
+	// Transform a triangle, returning false if it is invalid or too small on screen
+	auto GetTriangle = [&Batch, &Transform](const FTreeMeshSectionData& Section, int32 TriangleIndex,
+	                                        FVector& OutV0, FVector& OutV1, FVector& OutV2)
 	{
-		const int32 BaseIndex = i * 3;
-		if (BaseIndex + 2 >= MeshData.Triangles.Num())
+		const int32 BaseIndex = TriangleIndex * 3;
+
+		const int32 I0 = Section.Triangles[BaseIndex];
+		const int32 I1 = Section.Triangles[BaseIndex + 1];
+		const int32 I2 = Section.Triangles[BaseIndex + 2];
+
+		if (I0 >= Section.Vertices.Num() || I1 >= Section.Vertices.Num() || I2 >= Section.Vertices.Num())
 		{
-			break;
+			return false;
 		}
 
-		const int32 I0 = MeshData.Triangles[BaseIndex];
-		const int32 I1 = MeshData.Triangles[BaseIndex + 1];
-		const int32 I2 = MeshData.Triangles[BaseIndex + 2];
+		OutV0 = Transform.TransformPosition(Section.Vertices[I0]);
+		OutV1 = Transform.TransformPosition(Section.Vertices[I1]);
+		OutV2 = Transform.TransformPosition(Section.Vertices[I2]);
+
+		const double MaxEdgeSquared = FMath::Max3(FVector::DistSquared(OutV0, OutV1),
+		                                         FVector::DistSquared(OutV1, OutV2),
+		                                         FVector::DistSquared(OutV2, OutV0));
+		return Batch.IsVisible(OutV0, static_cast<float>(FMath::Sqrt(MaxEdgeSquared)) * 0.5f);
+	};
 
-		if (I0 >= MeshData.Vertices.Num() || I1 >= MeshData.Vertices.Num() || I2 >= MeshData.Vertices.Num())
+	// Count visible triangles across all sections so one stride covers the whole mesh
+	FVector V0, V1, V2;
+	int32 NumVisible = 0;
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+		const int32 NumTriangles = Section.Triangles.Num() / 3;
+		for (int32 i = 0; i < NumTriangles; ++i)
 		{
-			continue;
+			NumVisible += GetTriangle(Section, i, V0, V1, V2) ? 1 : 0;
 		}
+	}
+
+	const int32 Stride = Batch.GetStride(NumVisible, 3);
+	if (Stride <= 0)
+	{
+		return;
+	}
 
-		const FVector V0 = Transform.TransformPosition(MeshData.Vertices[I0]);
-		const FVector V1 = Transform.TransformPosition(MeshData.Vertices[I1]);
-		const FVector V2 = Transform.TransformPosition(MeshData.Vertices[I2]);
+	int32 VisibleIndex = 0;
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
 
-		DrawDebugLine(World, V0, V1, WireColor, false, Duration, 0, 0.5f);
-		DrawDebugLine(World, V1, V2, WireColor, false, Duration, 0, 0.5f);
-		DrawDebugLine(World, V2, V0, WireColor, false, Duration, 0, 0.5f);
+		// Draw each triangle as wireframe
+		const int32 NumTriangles = Section.Triangles.Num() / 3;
+		for (int32 i = 0; i < NumTriangles; ++i)
+		{
+			if (!GetTriangle(Section, i, V0, V1, V2) || (VisibleIndex++ % Stride) != 0)
+			{
+				continue;
+			}
+
+			Batch.AddLine(V0, V1, WireColor, 0.5f);
+			Batch.AddLine(V1, V2, WireColor, 0.5f);
+			Batch.AddLine(V2, V0, WireColor, 0.5f);
+		}
 	}
+
+	Batch.Submit();
 }
 
 void UTreeDebugDraw::DrawMeshNormals(const UObject* WorldContext,
@@ -316,29 +706,61 @@ void UTreeDebugDraw::DrawMeshNormals(const UObject* WorldContext,
                                       float NormalLength,
                                       float Duration)
 {
-	if (!WorldContext)
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeDebugDraw::DrawMeshNormals);
+
+	UWorld* World = GetDebugWorld(WorldContext);
+	if (!World)
 	{
 		return;
 	}
 
-	UWorld* World = WorldContext->GetWorld();
-	if (!World)
+	FDebugLineBatch Batch(World, Duration);
+	if (!Batch.IsValid())
 	{
 		return;
 	}
 
 	const FColor NormalColor = FColor::Blue;
+	const float HalfNormalLength = NormalLength * 0.5f;
+
+	int32 NumVisible = 0;
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+		const int32 NumVertices = FMath::Min(Section.Vertices.Num(), Section.Normals.Num());
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			NumVisible += Batch.IsVisible(Transform.TransformPosition(Section.Vertices[i]), HalfNormalLength) ? 1 : 0;
+		}
+	}
 
-	// Draw normal at each vertex
-	const int32 NumVertices = FMath::Min(MeshData.Vertices.Num(), MeshData.Normals.Num());
-	for (int32 i = 0; i < NumVertices; ++i)
+	const int32 Stride = Batch.GetStride(NumVisible, 1);
+	if (Stride <= 0)
 	{
-		const FVector Position = Transform.TransformPosition(MeshData.Vertices[i]);
-		const FVector Normal = Transform.TransformVector(MeshData.Normals[i]).GetSafeNormal();
-		const FVector NormalEnd = Position + Normal * NormalLength;
+		return;
+	}
 
-		DrawDebugLine(World, Position, NormalEnd, NormalColor, false, Duration, 0, 0.5f);
+	int32 VisibleIndex = 0;
+	for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+	{
+		const FTreeMeshSectionData& Section = MeshData.GetSection(SectionIndex);
+
+		// Draw normal at each vertex
+		const int32 NumVertices = FMath::Min(Section.Vertices.Num(), Section.Normals.Num());
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVector Position = Transform.TransformPosition(Section.Vertices[i]);
+			if (!Batch.IsVisible(Position, HalfNormalLength) || (VisibleIndex++ % Stride) != 0)
+			{
+				continue;
+			}
+
+			const FVector Normal = Transform.TransformVector(Section.Normals[i]).GetSafeNormal();
+			Batch.AddLine(Position, Position + Normal * NormalLength, NormalColor, 0.5f);
+		}
 	}
+
+	Batch.Submit();
 }
 
 // ============================================================================
@@ -407,3 +829,33 @@ FLinearColor UTreeDebugDraw::GetSymbolColor(const FString& Symbol)
 		return FLinearColor::White;
 	}
 }
+
+int32 UTreeDebugDraw::GetMaxDebugLines()
+{
+	return FMath::Max(0, CVarDebugDrawMaxLines.GetValueOnGameThread());
+}
+
+int32 UTreeDebugDraw::GetDecimationDepth(const TArray<int32>& SegmentsPerDepth, int32 LinesPerSegment,
+                                         int32 MaxLines, int32& OutStride)
+{
+	OutStride = 1;
+	if (MaxLines <= 0)
+	{
+		return SegmentsPerDepth.Num();
+	}
+
+	// Keep whole depths from the trunk outward, then stride the first depth that overflows
+	int32 RemainingSegments = MaxLines / FMath::Max(1, LinesPerSegment);
+	for (int32 Depth = 0; Depth < SegmentsPerDepth.Num(); ++Depth)
+	{
+		const int32 Count = SegmentsPerDepth[Depth];
+		if (Count > RemainingSegments)
+		{
+			OutStride = RemainingSegments > 0 ? FMath::DivideAndRoundUp(Count, RemainingSegments) : 0;
+			return Depth;
+		}
+		RemainingSegments -= Count;
+	}
+
+	return SegmentsPerDepth.Num();
+}
@@ -0,0 +1,424 @@
+// TreeBenchmark.cpp
+// Repeatable per-stage benchmarks of the generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/Utilities/TreeBenchmark.h"
+#include "Core/LSystem/LSystemGenerator.h"
+#include "Core/TreeGeometry/TurtleInterpreter.h"
+#include "Core/TreeGeometry/TreeGeometry.h"
+#include "Core/Utilities/TreeGenerationCache.h"
+#include "ProceduralMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/Package.h"
+
+// ============================================================================
+// Built-in Presets
+// ============================================================================
+
+namespace
+{
+	/** Preset as written in TREE_PRESETS.md (turtle settings in property export format) */
+	struct FTreeBenchmarkPresetSource
+	{
+		const TCHAR* Name;
+		const TCHAR* Axiom;
+		int32 Iterations;
+		const TCHAR* Rules[4][2];
+		const TCHAR* TurtleConfig;
+		float BarkUVTiling;
+	};
+
+	const FTreeBenchmarkPresetSource PresetSources[] =
+	{
+		{
+			TEXT("Birch"), TEXT("FFFFA"), 10,
+			{ { TEXT("A"), TEXT("[&+BL]////[&-BL]////[&BL]") }, { TEXT("B"), TEXT("F[--L][++L]A") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("FF") } },
+			TEXT("(DefaultAngle=18,PitchAngle=8,RollAngle=120,StepLength=30,InitialWidth=5,WidthFalloff=0.65,MinWidth=0.3,TropismStrength=0.02,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=6,Y=8),RandomSeed=1,BranchProbability=0.85,AngleVariationMin=-8,AngleVariationMax=8,StepLengthVariation=0.1,bRandomizePitchDirection=True,PitchFlipProbability=0.3,PitchVariationMin=-10,PitchVariationMax=10,InitialRandomRoll=360)"),
+			1.0f
+		},
+		{
+			TEXT("Oak"), TEXT("FFA"), 10,
+			{ { TEXT("A"), TEXT("[&&B]///[&&B]///[&&B]///[&&B]") }, { TEXT("B"), TEXT("FF[--L][++L][&L]FA") }, { TEXT("F"), TEXT("SF") }, { TEXT("S"), TEXT("F") } },
+			TEXT("(DefaultAngle=30,PitchAngle=35,RollAngle=90,StepLength=20,InitialWidth=12,WidthFalloff=0.55,MinWidth=0.6,TropismStrength=0.08,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=12,Y=14),RandomSeed=1,BranchProbability=0.8,AngleVariationMin=-20,AngleVariationMax=20,StepLengthVariation=0.2,bRandomizePitchDirection=True,PitchFlipProbability=0.4,PitchVariationMin=-15,PitchVariationMax=15,InitialRandomRoll=360)"),
+			1.2f
+		},
+		{
+			TEXT("Willow"), TEXT("FFFA"), 11,
+			{ { TEXT("A"), TEXT("[&&&B]////[&&&B]////[&&&B]") }, { TEXT("B"), TEXT("F[--L][++L]F[&L]A") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("FF") } },
+			TEXT("(DefaultAngle=15,PitchAngle=45,RollAngle=120,StepLength=22,InitialWidth=10,WidthFalloff=0.58,MinWidth=0.2,TropismStrength=0.25,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=4,Y=18),RandomSeed=1,BranchProbability=0.9,AngleVariationMin=-10,AngleVariationMax=10,StepLengthVariation=0.12,bRandomizePitchDirection=False,PitchFlipProbability=0.15,PitchVariationMin=-5,PitchVariationMax=20,InitialRandomRoll=360)"),
+			0.8f
+		},
+		{
+			TEXT("Cherry"), TEXT("FFFA"), 11,
+			{ { TEXT("A"), TEXT("[&+B]////[&-B]////[&B]") }, { TEXT("B"), TEXT("F[--LL][++LL]FA") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("F") } },
+			TEXT("(DefaultAngle=28,PitchAngle=18,RollAngle=120,StepLength=18,InitialWidth=6,WidthFalloff=0.62,MinWidth=0.35,TropismStrength=0.06,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=8,Y=10),RandomSeed=1,BranchProbability=0.82,AngleVariationMin=-12,AngleVariationMax=12,StepLengthVariation=0.1,bRandomizePitchDirection=True,PitchFlipProbability=0.5,PitchVariationMin=-18,PitchVariationMax=18,InitialRandomRoll=360)"),
+			1.0f
+		},
+		{
+			TEXT("Apple"), TEXT("FFFA"), 12,
+			{ { TEXT("A"), TEXT("[&B]////[&B]////[&B]") }, { TEXT("B"), TEXT("F[--L][++L]FA") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("F") } },
+			TEXT("(DefaultAngle=25,PitchAngle=12,RollAngle=120,StepLength=25,InitialWidth=8,WidthFalloff=0.6,MinWidth=0.5,TropismStrength=0.1,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=10,Y=15),RandomSeed=1,BranchProbability=0.75,AngleVariationMin=-15,AngleVariationMax=15,StepLengthVariation=0.15,bRandomizePitchDirection=True,PitchFlipProbability=0.45,PitchVariationMin=-25,PitchVariationMax=25,InitialRandomRoll=360)"),
+			1.0f
+		},
+		{
+			TEXT("Pear"), TEXT("FFFFA"), 10,
+			{ { TEXT("A"), TEXT("[^&B]/////[^&B]/////[^&B]") }, { TEXT("B"), TEXT("F[--L][++L]A") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("FF") } },
+			TEXT("(DefaultAngle=22,PitchAngle=25,RollAngle=72,StepLength=28,InitialWidth=7,WidthFalloff=0.64,MinWidth=0.4,TropismStrength=0.03,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=9,Y=12),RandomSeed=1,BranchProbability=0.78,AngleVariationMin=-10,AngleVariationMax=10,StepLengthVariation=0.1,bRandomizePitchDirection=True,PitchFlipProbability=0.35,PitchVariationMin=-15,PitchVariationMax=15,InitialRandomRoll=360)"),
+			1.0f
+		},
+		{
+			TEXT("Plum"), TEXT("FFA"), 11,
+			{ { TEXT("A"), TEXT("[&+B]///[&-B]///[&B]///[&B]") }, { TEXT("B"), TEXT("F[-L][+L]FA") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("F") } },
+			TEXT("(DefaultAngle=32,PitchAngle=15,RollAngle=90,StepLength=16,InitialWidth=5.5,WidthFalloff=0.6,MinWidth=0.35,TropismStrength=0.07,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=7,Y=9),RandomSeed=1,BranchProbability=0.85,AngleVariationMin=-14,AngleVariationMax=14,StepLengthVariation=0.12,bRandomizePitchDirection=True,PitchFlipProbability=0.48,PitchVariationMin=-20,PitchVariationMax=20,InitialRandomRoll=360)"),
+			1.1f
+		},
+		{
+			TEXT("Peach"), TEXT("FFFA"), 11,
+			{ { TEXT("A"), TEXT("[&&+B]////[&&-B]////[&&B]") }, { TEXT("B"), TEXT("F[--L][++L]FA") }, { TEXT("F"), TEXT("S") }, { TEXT("S"), TEXT("F") } },
+			TEXT("(DefaultAngle=30,PitchAngle=22,RollAngle=120,StepLength=20,InitialWidth=6,WidthFalloff=0.61,MinWidth=0.35,TropismStrength=0.09,GravityVector=(X=0,Y=0,Z=-1),InitialPosition=(X=0,Y=0,Z=0),InitialForward=(X=0,Y=0,Z=1),LeafSize=(X=8,Y=12),RandomSeed=1,BranchProbability=0.8,AngleVariationMin=-15,AngleVariationMax=15,StepLengthVariation=0.13,bRandomizePitchDirection=True,PitchFlipProbability=0.4,PitchVariationMin=-18,PitchVariationMax=18,InitialRandomRoll=360)"),
+			1.0f
+		}
+	};
+
+	/** Fastest of two timings, treating 0 as "not measured yet" */
+	double KeepFastest(double Current, double Sample)
+	{
+		return Current > 0.0 ? FMath::Min(Current, Sample) : Sample;
+	}
+
+	/** Milliseconds since a FPlatformTime::Seconds() timestamp */
+	double MillisecondsSince(double StartSeconds)
+	{
+		return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	}
+}
+
+const TArray<FTreeBenchmarkPreset>& FTreeBenchmark::GetBuiltinPresets()
+{
+	static const TArray<FTreeBenchmarkPreset> Presets = []()
+	{
+		TArray<FTreeBenchmarkPreset> Result;
+		for (const FTreeBenchmarkPresetSource& Source : PresetSources)
+		{
+			FTreeBenchmarkPreset& Preset = Result.AddDefaulted_GetRef();
+			Preset.Name = Source.Name;
+			Preset.Axiom = Source.Axiom;
+			Preset.Iterations = Source.Iterations;
+
+			for (const auto& Rule : Source.Rules)
+			{
+				FLSystemRule& NewRule = Preset.Rules.AddDefaulted_GetRef();
+				NewRule.Predecessor = Rule[0];
+				NewRule.Successor = Rule[1];
+				NewRule.Probability = 1.0f;
+			}
+
+			FTurtleConfig::StaticStruct()->ImportText(Source.TurtleConfig, &Preset.TurtleConfig, nullptr, PPF_None,
+			                                          GLog, TEXT("FTurtleConfig"));
+
+			Preset.GeometryConfig.BarkUVTiling = Source.BarkUVTiling;
+			Preset.GeometryConfig.LeafSize = Preset.TurtleConfig.LeafSize;
+		}
+		return Result;
+	}();
+
+	return Presets;
+}
+
+// ============================================================================
+// FTreeBenchmarkResult
+// ============================================================================
+
+FString FTreeBenchmarkResult::GetKey() const
+{
+	return FString::Printf(TEXT("%s/%d/%d"), *Preset, Iterations, Seed);
+}
+
+double FTreeBenchmarkResult::GetSymbolsPerSecond() const
+{
+	return GenerateMs > 0.0 ? Symbols / (GenerateMs / 1000.0) : 0.0;
+}
+
+double FTreeBenchmarkResult::GetSegmentsPerSecond() const
+{
+	return InterpretMs > 0.0 ? Segments / (InterpretMs / 1000.0) : 0.0;
+}
+
+double FTreeBenchmarkResult::GetTrianglesPerSecond() const
+{
+	int64 Triangles = 0;
+	for (int32 Count : LODTriangles)
+	{
+		Triangles += Count;
+	}
+	return AllLODsMs > 0.0 ? Triangles / (AllLODsMs / 1000.0) : 0.0;
+}
+
+// ============================================================================
+// Running
+// ============================================================================
+
+FTreeBenchmarkResult FTreeBenchmark::RunCase(const FTreeBenchmarkPreset& Preset, int32 Iterations, int32 Seed,
+                                             int32 Repeats, int32 MaxStringLength)
+{
+	FTreeBenchmarkResult Result;
+	Result.Preset = Preset.Name;
+	Result.Iterations = Iterations;
+	Result.Seed = Seed;
+
+	const TArray<FTreeLODLevel>& LODLevels = Preset.GeometryConfig.LODLevels;
+	Result.LODMs.SetNumZeroed(LODLevels.Num());
+
+	FTurtleConfig TurtleConfig = Preset.TurtleConfig;
+	TurtleConfig.RandomSeed = Seed;
+
+	ULSystemGenerator* Generator = NewObject<ULSystemGenerator>(GetTransientPackage());
+	UTurtleInterpreter* Interpreter = NewObject<UTurtleInterpreter>(GetTransientPackage());
+	UTreeGeometry* GeometryBuilder = NewObject<UTreeGeometry>(GetTransientPackage());
+	UProceduralMeshComponent* UploadTarget = NewObject<UProceduralMeshComponent>(GetTransientPackage());
+
+	Generator->Config.MaxIterations = FMath::Max(Generator->Config.MaxIterations, Iterations);
+	Generator->Config.MaxStringLength = MaxStringLength;
+	Generator->Config.bStoreHistory = false;
+	Generator->Config.bEnableDetailedLogging = false;
+
+	GeometryBuilder->BarkUVTiling = Preset.GeometryConfig.BarkUVTiling;
+	GeometryBuilder->DefaultLeafSize = Preset.GeometryConfig.LeafSize;
+	GeometryBuilder->bSmoothNormals = Preset.GeometryConfig.bSmoothNormals;
+
+	FTreeGeneratedData Data;
+
+	for (int32 Repeat = 0; Repeat < FMath::Max(Repeats, 1); ++Repeat)
+	{
+		// Stage 1: L-System rewriting
+		Generator->Reset();
+		Generator->Initialize(Preset.Axiom);
+		for (const FLSystemRule& Rule : Preset.Rules)
+		{
+			Generator->AddRule(Rule);
+		}
+		Generator->SetRandomSeed(Seed);
+
+		double StartTime = FPlatformTime::Seconds();
+		FLSystemGenerationResult GenResult = Generator->GenerateSymbols(Iterations);
+		Result.GenerateMs = KeepFastest(Result.GenerateMs, MillisecondsSince(StartTime));
+
+		if (!GenResult.bSuccess)
+		{
+			UE_LOG(LogTemp, Error, TEXT("TreeBenchmark: %s failed: %s"), *Result.GetKey(), *GenResult.ErrorMessage);
+			return Result;
+		}
+		Data.Symbols = MoveTemp(GenResult.Symbols);
+
+		// Stage 2: Turtle interpretation
+		StartTime = FPlatformTime::Seconds();
+		Interpreter->InterpretSymbolsToSkeleton(Data.Symbols, TurtleConfig, Data.Skeleton);
+		Result.InterpretMs = KeepFastest(Result.InterpretMs, MillisecondsSince(StartTime));
+
+		// Stage 3a: Each LOD on its own, to attribute mesh cost per detail level
+		for (int32 LODIndex = 0; LODIndex < LODLevels.Num(); ++LODIndex)
+		{
+			const TArray<FTreeLODLevel> SingleLOD = { LODLevels[LODIndex] };
+
+			StartTime = FPlatformTime::Seconds();
+			GeometryBuilder->GenerateMeshLODsFromSkeleton(Data.Skeleton, SingleLOD);
+			Result.LODMs[LODIndex] = KeepFastest(Result.LODMs[LODIndex], MillisecondsSince(StartTime));
+		}
+
+		// Stage 3b: All LODs together (what a generation actually waits for)
+		StartTime = FPlatformTime::Seconds();
+		Data.LODs = GeometryBuilder->GenerateMeshLODsFromSkeleton(Data.Skeleton, LODLevels);
+		Result.AllLODsMs = KeepFastest(Result.AllLODsMs, MillisecondsSince(StartTime));
+
+		// Stage 4: Section upload (unregistered component - measures the copies, not the GPU transfer)
+		UploadTarget->ClearAllMeshSections();
+		StartTime = FPlatformTime::Seconds();
+		for (int32 LODIndex = 0; LODIndex < Data.LODs.Num(); ++LODIndex)
+		{
+			for (int32 SectionIndex = 0; SectionIndex < FTreeMeshData::NumSections; ++SectionIndex)
+			{
+				const FTreeMeshSectionData& Section = Data.LODs[LODIndex].GetSection(SectionIndex);
+				if (Section.IsValid())
+				{
+					UploadTarget->CreateMeshSection(LODIndex * FTreeMeshData::NumSections + SectionIndex, Section.Vertices,
+					                                Section.Triangles, Section.Normals, Section.UVs, Section.VertexColors,
+					                                Section.Tangents, false);
+				}
+			}
+		}
+		Result.UploadMs = KeepFastest(Result.UploadMs, MillisecondsSince(StartTime));
+	}
+
+	Result.Symbols = Data.Symbols.Num();
+	Result.Segments = Data.Skeleton.NumSegments();
+	Result.Leaves = Data.Skeleton.NumLeaves();
+	for (const FTreeMeshData& LOD : Data.LODs)
+	{
+		Result.LODTriangles.Add(LOD.GetTriangleCount());
+	}
+	Result.OutputBytes = Data.GetAllocatedSize();
+	Result.PeakUsedPhysical = FPlatformMemory::GetStats().PeakUsedPhysical;
+
+	UploadTarget->ClearAllMeshSections();
+	UploadTarget->MarkAsGarbage();
+
+	UE_LOG(LogTemp, Log, TEXT("TreeBenchmark: %s - gen %.2fms, turtle %.2fms, LODs %.2fms, upload %.2fms (%d symbols, %d segments)"),
+	       *Result.GetKey(), Result.GenerateMs, Result.InterpretMs, Result.AllLODsMs, Result.UploadMs,
+	       Result.Symbols, Result.Segments);
+
+	return Result;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+TSharedRef<FJsonObject> FTreeBenchmark::ToJson(const TArray<FTreeBenchmarkResult>& Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Cases;
+	for (const FTreeBenchmarkResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> Case = MakeShared<FJsonObject>();
+		Case->SetStringField(TEXT("Key"), Result.GetKey());
+		Case->SetStringField(TEXT("Preset"), Result.Preset);
+		Case->SetNumberField(TEXT("Iterations"), Result.Iterations);
+		Case->SetNumberField(TEXT("Seed"), Result.Seed);
+
+		Case->SetNumberField(TEXT("GenerateMs"), Result.GenerateMs);
+		Case->SetNumberField(TEXT("InterpretMs"), Result.InterpretMs);
+		Case->SetNumberField(TEXT("AllLODsMs"), Result.AllLODsMs);
+		Case->SetNumberField(TEXT("UploadMs"), Result.UploadMs);
+		Case->SetNumberField(TEXT("TotalMs"), Result.GetTotalMs());
+
+		TArray<TSharedPtr<FJsonValue>> LODs;
+		for (int32 LODIndex = 0; LODIndex < Result.LODMs.Num(); ++LODIndex)
+		{
+			TSharedRef<FJsonObject> LOD = MakeShared<FJsonObject>();
+			LOD->SetNumberField(TEXT("Ms"), Result.LODMs[LODIndex]);
+			LOD->SetNumberField(TEXT("Triangles"), Result.LODTriangles.IsValidIndex(LODIndex) ? Result.LODTriangles[LODIndex] : 0);
+			LODs.Add(MakeShared<FJsonValueObject>(LOD));
+		}
+		Case->SetArrayField(TEXT("LODs"), LODs);
+
+		Case->SetNumberField(TEXT("Symbols"), Result.Symbols);
+		Case->SetNumberField(TEXT("Segments"), Result.Segments);
+		Case->SetNumberField(TEXT("Leaves"), Result.Leaves);
+		Case->SetNumberField(TEXT("SymbolsPerSecond"), Result.GetSymbolsPerSecond());
+		Case->SetNumberField(TEXT("SegmentsPerSecond"), Result.GetSegmentsPerSecond());
+		Case->SetNumberField(TEXT("TrianglesPerSecond"), Result.GetTrianglesPerSecond());
+		Case->SetNumberField(TEXT("OutputBytes"), static_cast<double>(Result.OutputBytes));
+		Case->SetNumberField(TEXT("PeakUsedPhysical"), static_cast<double>(Result.PeakUsedPhysical));
+
+		Cases.Add(MakeShared<FJsonValueObject>(Case));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetNumberField(TEXT("Cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Root->SetArrayField(TEXT("Cases"), Cases);
+	return Root;
+}
+
+bool FTreeBenchmark::SaveJson(const TArray<FTreeBenchmarkResult>& Results, const FString& FilePath)
+{
+	FString Text;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+	if (!FJsonSerializer::Serialize(ToJson(Results), Writer))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Text, *FilePath);
+}
+
+bool FTreeBenchmark::SaveCsv(const TArray<FTreeBenchmarkResult>& Results, const FString& FilePath)
+{
+	int32 MaxLODs = 0;
+	for (const FTreeBenchmarkResult& Result : Results)
+	{
+		MaxLODs = FMath::Max(MaxLODs, Result.LODMs.Num());
+	}
+
+	FString Text = TEXT("Preset,Iterations,Seed,GenerateMs,InterpretMs,AllLODsMs,UploadMs,TotalMs");
+	for (int32 LODIndex = 0; LODIndex < MaxLODs; ++LODIndex)
+	{
+		Text += FString::Printf(TEXT(",LOD%dMs,LOD%dTriangles"), LODIndex, LODIndex);
+	}
+	Text += TEXT(",Symbols,Segments,Leaves,SymbolsPerSecond,SegmentsPerSecond,TrianglesPerSecond,OutputBytes,PeakUsedPhysical\n");
+
+	for (const FTreeBenchmarkResult& Result : Results)
+	{
+		Text += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f"), *Result.Preset, Result.Iterations, Result.Seed,
+		                        Result.GenerateMs, Result.InterpretMs, Result.AllLODsMs, Result.UploadMs, Result.GetTotalMs());
+		for (int32 LODIndex = 0; LODIndex < MaxLODs; ++LODIndex)
+		{
+			const bool bHasLOD = Result.LODMs.IsValidIndex(LODIndex);
+			Text += FString::Printf(TEXT(",%.3f,%d"), bHasLOD ? Result.LODMs[LODIndex] : 0.0,
+			                        Result.LODTriangles.IsValidIndex(LODIndex) ? Result.LODTriangles[LODIndex] : 0);
+		}
+		Text += FString::Printf(TEXT(",%d,%d,%d,%.0f,%.0f,%.0f,%llu,%llu\n"), Result.Symbols, Result.Segments, Result.Leaves,
+		                        Result.GetSymbolsPerSecond(), Result.GetSegmentsPerSecond(), Result.GetTrianglesPerSecond(),
+		                        Result.OutputBytes, Result.PeakUsedPhysical);
+	}
+
+	return FFileHelper::SaveStringToFile(Text, *FilePath);
+}
+
+bool FTreeBenchmark::CompareToBaseline(const TArray<FTreeBenchmarkResult>& Results, const FString& BaselinePath,
+                                       double Tolerance, TArray<FString>& OutRegressions)
+{
+	OutRegressions.Reset();
+
+	FString Text;
+	TSharedPtr<FJsonObject> Root;
+	if (!FFileHelper::LoadFileToString(Text, *BaselinePath) ||
+	    !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("TreeBenchmark: Could not read baseline %s"), *BaselinePath);
+		return false;
+	}
+
+	TMap<FString, TSharedPtr<FJsonObject>> BaselineCases;
+	for (const TSharedPtr<FJsonValue>& Value : Root->GetArrayField(TEXT("Cases")))
+	{
+		const TSharedPtr<FJsonObject>& Case = Value->AsObject();
+		if (Case.IsValid())
+		{
+			BaselineCases.Add(Case->GetStringField(TEXT("Key")), Case);
+		}
+	}
+
+	for (const FTreeBenchmarkResult& Result : Results)
+	{
+		const TSharedPtr<FJsonObject>* Baseline = BaselineCases.Find(Result.GetKey());
+		if (!Baseline)
+		{
+			continue;
+		}
+
+		const TPair<const TCHAR*, double> Stages[] = {
+			{ TEXT("GenerateMs"), Result.GenerateMs },
+			{ TEXT("InterpretMs"), Result.InterpretMs },
+			{ TEXT("AllLODsMs"), Result.AllLODsMs },
+			{ TEXT("UploadMs"), Result.UploadMs },
+			{ TEXT("TotalMs"), Result.GetTotalMs() }
+		};
+
+		for (const TPair<const TCHAR*, double>& Stage : Stages)
+		{
+			const double BaselineMs = (*Baseline)->GetNumberField(Stage.Key);
+			if (BaselineMs > 0.0 && Stage.Value > BaselineMs * (1.0 + Tolerance))
+			{
+				OutRegressions.Add(FString::Printf(TEXT("%s %s: %.2fms vs baseline %.2fms (+%.0f%%)"), *Result.GetKey(), Stage.Key,
+				                                   Stage.Value, BaselineMs, (Stage.Value / BaselineMs - 1.0) * 100.0));
+			}
+		}
+	}
+
+	return true;
+}
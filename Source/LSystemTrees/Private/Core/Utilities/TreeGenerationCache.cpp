@@ -0,0 +1,590 @@
+// TreeGenerationCache.cpp
+// Process-wide content-addressed cache of generated trees
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/Utilities/TreeGenerationCache.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UnrealType.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Tasks/Task.h"
+
+#if WITH_EDITOR
+#include "DerivedDataCacheInterface.h"
+#endif
+
+static TAutoConsoleVariable<int32> CVarTreeCacheBudgetMB(
+	TEXT("LSystemTrees.TreeCache.BudgetMB"),
+	256,
+	TEXT("Memory budget of the process-wide generated tree cache in MB (0 disables caching)."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdTreeCacheFlush(
+	TEXT("LSystemTrees.TreeCache.Flush"),
+	TEXT("Drop all entries of the generated tree cache."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FTreeGenerationCache::Get().Empty();
+	}));
+
+static TAutoConsoleVariable<int32> CVarTreeCachePersistent(
+	TEXT("LSystemTrees.TreeCache.Persistent"),
+	1,
+	TEXT("Persist generated trees across sessions (editor: derived data cache, cooked: Saved/LSystemTrees/TreeCache)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTreeCachePersistentBudgetMB(
+	TEXT("LSystemTrees.TreeCache.PersistentBudgetMB"),
+	512,
+	TEXT("Disk budget of the cooked-build persistent tree cache in MB; least recently used blobs are deleted beyond it\n")
+	TEXT("(0 = unlimited). Editor builds use the derived data cache, which evicts on its own."),
+	ECVF_Default);
+
+/** Upper bound on entry count (the memory budget is normally hit first) */
+static constexpr int32 TreeCacheMaxEntries = 4096;
+
+/** Blob header; bump the version whenever the serialized layout or the generated content changes */
+static constexpr uint32 TreeBlobMagic = 0x5254534C; // 'LSTR'
+static constexpr uint32 TreeBlobVersion = 3;
+
+// ============================================================================
+// FTreeGeneratedData
+// ============================================================================
+
+SIZE_T FTreeGeneratedData::GetAllocatedSize() const
+{
+	SIZE_T Size = Symbols.GetAllocatedSize() + Skeleton.GetAllocatedSize() + LODs.GetAllocatedSize();
+
+	for (const FTreeMeshData& LOD : LODs)
+	{
+		Size += LOD.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+// Vectors are stored as single precision - the generated geometry never needs doubles
+static void SerializeVector(FArchive& Ar, FVector& Vector)
+{
+	FVector3f Value(Vector);
+	Ar << Value;
+
+	if (Ar.IsLoading())
+	{
+		Vector = FVector(Value);
+	}
+}
+
+static void SerializeVector2D(FArchive& Ar, FVector2D& Vector)
+{
+	FVector2f Value(Vector);
+	Ar << Value;
+
+	if (Ar.IsLoading())
+	{
+		Vector = FVector2D(Value);
+	}
+}
+
+template<typename ElementType, typename SerializeFunc>
+static void SerializeArray(FArchive& Ar, TArray<ElementType>& Array, SerializeFunc&& SerializeElement)
+{
+	int32 Num = Array.Num();
+	Ar << Num;
+
+	if (Ar.IsLoading())
+	{
+		// Every element takes at least one byte, so a larger count means a corrupt blob
+		if (Num < 0 || Num > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Array.SetNum(Num);
+	}
+
+	for (ElementType& Element : Array)
+	{
+		SerializeElement(Ar, Element);
+	}
+}
+
+/** Plain-data array stored as raw bytes (skeleton streams are already single precision) */
+template<typename ElementType>
+static void SerializeBulkArray(FArchive& Ar, TArray<ElementType>& Array)
+{
+	int32 Num = Array.Num();
+	Ar << Num;
+
+	if (Ar.IsLoading())
+	{
+		if (Num < 0 || static_cast<int64>(Num) * sizeof(ElementType) > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Array.SetNumUninitialized(Num);
+	}
+
+	Ar.Serialize(Array.GetData(), static_cast<int64>(Num) * sizeof(ElementType));
+}
+
+static void SerializeVectorArray(FArchive& Ar, TArray<FVector>& Array)
+{
+	SerializeArray(Ar, Array, SerializeVector);
+}
+
+static void SerializeSection(FArchive& Ar, FTreeMeshSectionData& Section)
+{
+	SerializeVectorArray(Ar, Section.Vertices);
+	Section.Triangles.BulkSerialize(Ar);
+	SerializeVectorArray(Ar, Section.Normals);
+	SerializeArray(Ar, Section.UVs, SerializeVector2D);
+	Ar << Section.VertexColors;
+	SerializeArray(Ar, Section.Tangents, [](FArchive& InAr, FProcMeshTangent& Tangent)
+	{
+		SerializeVector(InAr, Tangent.TangentX);
+		InAr << Tangent.bFlipTangentY;
+	});
+}
+
+bool FTreeGeneratedData::Serialize(FArchive& Ar)
+{
+	uint32 Magic = TreeBlobMagic;
+	uint32 Version = TreeBlobVersion;
+	Ar << Magic;
+	Ar << Version;
+
+	if (Ar.IsLoading() && (Magic != TreeBlobMagic || Version != TreeBlobVersion))
+	{
+		return false;
+	}
+
+	Ar << Symbols.Data;
+
+	SerializeBulkArray(Ar, Skeleton.SegmentStarts);
+	SerializeBulkArray(Ar, Skeleton.SegmentEnds);
+	SerializeBulkArray(Ar, Skeleton.SegmentDirections);
+	SerializeBulkArray(Ar, Skeleton.StartRadii);
+	SerializeBulkArray(Ar, Skeleton.EndRadii);
+	SerializeBulkArray(Ar, Skeleton.ParentIndices);
+	SerializeBulkArray(Ar, Skeleton.SegmentDepths);
+
+	SerializeBulkArray(Ar, Skeleton.LeafPositions);
+	SerializeBulkArray(Ar, Skeleton.LeafNormals);
+	SerializeBulkArray(Ar, Skeleton.LeafUps);
+	SerializeBulkArray(Ar, Skeleton.LeafSizes);
+	SerializeBulkArray(Ar, Skeleton.LeafRotations);
+	SerializeBulkArray(Ar, Skeleton.LeafDepths);
+
+	// Every segment/leaf stream must describe the same elements
+	if (Ar.IsLoading())
+	{
+		const int32 NumSegments = Skeleton.NumSegments();
+		const int32 NumLeaves = Skeleton.NumLeaves();
+		if (Skeleton.SegmentEnds.Num() != NumSegments || Skeleton.SegmentDirections.Num() != NumSegments ||
+		    Skeleton.StartRadii.Num() != NumSegments || Skeleton.EndRadii.Num() != NumSegments ||
+		    Skeleton.ParentIndices.Num() != NumSegments || Skeleton.SegmentDepths.Num() != NumSegments ||
+		    Skeleton.LeafNormals.Num() != NumLeaves || Skeleton.LeafUps.Num() != NumLeaves ||
+		    Skeleton.LeafSizes.Num() != NumLeaves || Skeleton.LeafRotations.Num() != NumLeaves ||
+		    Skeleton.LeafDepths.Num() != NumLeaves)
+		{
+			Ar.SetError();
+		}
+	}
+
+	SerializeArray(Ar, LODs, [](FArchive& InAr, FTreeMeshData& LOD)
+	{
+		SerializeSection(InAr, LOD.Branches);
+		SerializeSection(InAr, LOD.Leaves);
+	});
+
+	return !Ar.IsError();
+}
+
+const FTreeGeneratedDataPtr& FTreeGeneratedData::GetEmpty()
+{
+	static const FTreeGeneratedDataPtr Empty = MakeShared<FTreeGeneratedData, ESPMode::ThreadSafe>();
+	return Empty;
+}
+
+// ============================================================================
+// FTreeGenerationCache
+// ============================================================================
+
+FTreeGenerationCache::FTreeGenerationCache()
+	: Entries(TreeCacheMaxEntries)
+	, MemoryUsage(0)
+{
+}
+
+FTreeGenerationCache& FTreeGenerationCache::Get()
+{
+	static FTreeGenerationCache Instance;
+	return Instance;
+}
+
+FTreeGeneratedDataPtr FTreeGenerationCache::Find(const FSHAHash& Key)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FTreeGeneratedDataPtr* Found = Entries.FindAndTouch(Key);
+	return Found ? *Found : FTreeGeneratedDataPtr();
+}
+
+void FTreeGenerationCache::Add(const FSHAHash& Key, const FTreeGeneratedDataPtr& Data)
+{
+	if (!Data.IsValid())
+	{
+		return;
+	}
+
+	const SIZE_T BudgetBytes = GetBudgetBytes();
+	const SIZE_T DataSize = Data->GetAllocatedSize();
+
+	FScopeLock ScopeLock(&Lock);
+
+	// Replacing an entry: release its accounted size first
+	if (const FTreeGeneratedDataPtr* Existing = Entries.FindAndTouch(Key))
+	{
+		MemoryUsage -= (*Existing)->GetAllocatedSize();
+		Entries.Remove(Key);
+	}
+
+	// Larger than the whole budget (or caching disabled) - never cache, but keep what's there
+	if (DataSize > BudgetBytes)
+	{
+		EvictToBudget(BudgetBytes);
+		return;
+	}
+
+	// Make room first so the LRU never silently drops an entry we still account for
+	EvictToBudget(BudgetBytes - DataSize);
+	if (Entries.Num() >= Entries.Max())
+	{
+		MemoryUsage -= Entries.RemoveLeastRecent()->GetAllocatedSize();
+	}
+
+	Entries.Add(Key, Data);
+	MemoryUsage += DataSize;
+}
+
+void FTreeGenerationCache::Remove(const FSHAHash& Key)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (const FTreeGeneratedDataPtr* Existing = Entries.FindAndTouch(Key))
+	{
+		MemoryUsage -= (*Existing)->GetAllocatedSize();
+		Entries.Remove(Key);
+	}
+}
+
+void FTreeGenerationCache::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Entries.Empty(TreeCacheMaxEntries);
+	MemoryUsage = 0;
+}
+
+int32 FTreeGenerationCache::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Entries.Num();
+}
+
+SIZE_T FTreeGenerationCache::GetMemoryUsage() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return MemoryUsage;
+}
+
+SIZE_T FTreeGenerationCache::GetBudgetBytes()
+{
+	return static_cast<SIZE_T>(FMath::Max(CVarTreeCacheBudgetMB.GetValueOnAnyThread(), 0)) * 1024 * 1024;
+}
+
+void FTreeGenerationCache::EvictToBudget(SIZE_T BudgetBytes)
+{
+	while (MemoryUsage > BudgetBytes && Entries.Num() > 0)
+	{
+		MemoryUsage -= Entries.RemoveLeastRecent()->GetAllocatedSize();
+	}
+}
+
+// ============================================================================
+// Key Hashing
+// ============================================================================
+
+static void HashPropertyValue(FSHA1& Hasher, const FProperty* Property, const void* Value)
+{
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		FTreeGenerationCache::HashString(Hasher, StrProperty->GetPropertyValue(Value));
+	}
+	else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		// Bitfield bools share storage with other fields, so hash the logical value
+		FTreeGenerationCache::HashValue(Hasher, static_cast<uint8>(BoolProperty->GetPropertyValue(Value) ? 1 : 0));
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		FTreeGenerationCache::HashStruct(Hasher, StructProperty->Struct, Value);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, Value);
+		FTreeGenerationCache::HashValue(Hasher, ArrayHelper.Num());
+
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			HashPropertyValue(Hasher, ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index));
+		}
+	}
+	else if (Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>())
+	{
+		Hasher.Update(static_cast<const uint8*>(Value), Property->GetSize() / Property->ArrayDim);
+	}
+	else if (Property->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+	{
+		FTreeGenerationCache::HashValue(Hasher, Property->GetValueTypeHash(Value));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TreeGenerationCache: Property '%s' is not hashed"), *Property->GetName());
+	}
+}
+
+void FTreeGenerationCache::HashStruct(FSHA1& Hasher, const UStruct* Struct, const void* Data)
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+		{
+			HashPropertyValue(Hasher, *It, It->ContainerPtrToValuePtr<void>(Data, ArrayIndex));
+		}
+	}
+}
+
+void FTreeGenerationCache::HashString(FSHA1& Hasher, const FString& String)
+{
+	const int32 Length = String.Len();
+	HashValue(Hasher, Length);
+	Hasher.Update(reinterpret_cast<const uint8*>(*String), Length * sizeof(TCHAR));
+}
+
+// ============================================================================
+// FTreeGenerationDiskCache
+// ============================================================================
+
+#if !WITH_EDITOR
+namespace
+{
+	/**
+	 * Size and last use of every blob in the cooked persistent cache, for LRU eviction.
+	 * Uses refresh the file timestamp, so the order survives restarts. Thread-safe.
+	 */
+	class FTreeBlobIndex
+	{
+	public:
+		static FTreeBlobIndex& Get()
+		{
+			static FTreeBlobIndex Instance;
+			return Instance;
+		}
+
+		/** Record a use of an existing blob */
+		void Touch(const FString& Path)
+		{
+			const FDateTime Now = FDateTime::UtcNow();
+			IFileManager::Get().SetTimeStamp(*Path, Now);
+
+			FScopeLock ScopeLock(&Lock);
+			ScanIfNeeded(FPaths::GetPath(Path));
+
+			if (FEntry* Entry = Entries.Find(FPaths::GetCleanFilename(Path)))
+			{
+				Entry->LastUse = Now;
+			}
+		}
+
+		/** Record a newly written blob, then delete least recently used blobs down to the budget */
+		void Add(const FString& Path, int64 Size, int64 BudgetBytes)
+		{
+			FScopeLock ScopeLock(&Lock);
+			ScanIfNeeded(FPaths::GetPath(Path));
+
+			FEntry& Entry = Entries.FindOrAdd(FPaths::GetCleanFilename(Path));
+			TotalBytes += Size - Entry.Size;
+			Entry.Size = Size;
+			Entry.LastUse = FDateTime::UtcNow();
+
+			if (BudgetBytes <= 0)
+			{
+				return;
+			}
+
+			const FString Directory = FPaths::GetPath(Path);
+			while (TotalBytes > BudgetBytes && Entries.Num() > 0)
+			{
+				const TPair<FString, FEntry>* Oldest = nullptr;
+				for (const TPair<FString, FEntry>& Pair : Entries)
+				{
+					if (!Oldest || Pair.Value.LastUse < Oldest->Value.LastUse)
+					{
+						Oldest = &Pair;
+					}
+				}
+
+				const FString OldestName = Oldest->Key;
+				IFileManager::Get().Delete(*(Directory / OldestName), false, false, true);
+				TotalBytes -= Oldest->Value.Size;
+				Entries.Remove(OldestName);
+			}
+		}
+
+		/** Forget a blob that was deleted */
+		void Remove(const FString& Path)
+		{
+			FScopeLock ScopeLock(&Lock);
+
+			FEntry Entry;
+			if (Entries.RemoveAndCopyValue(FPaths::GetCleanFilename(Path), Entry))
+			{
+				TotalBytes -= Entry.Size;
+			}
+		}
+
+	private:
+		struct FEntry
+		{
+			int64 Size = 0;
+			FDateTime LastUse;
+		};
+
+		/** Pick up blobs written by earlier sessions (lock held) */
+		void ScanIfNeeded(const FString& Directory)
+		{
+			if (bScanned)
+			{
+				return;
+			}
+			bScanned = true;
+
+			IFileManager::Get().IterateDirectoryStat(*Directory, [this](const TCHAR* Filename, const FFileStatData& StatData)
+			{
+				if (!StatData.bIsDirectory && FPaths::GetExtension(Filename) == TEXT("ltree"))
+				{
+					FEntry& Entry = Entries.FindOrAdd(FPaths::GetCleanFilename(Filename));
+					Entry.Size = StatData.FileSize;
+					Entry.LastUse = StatData.ModificationTime;
+					TotalBytes += StatData.FileSize;
+				}
+				return true;
+			});
+		}
+
+		FCriticalSection Lock;
+
+		/** Blob file name -> size and last use */
+		TMap<FString, FEntry> Entries;
+
+		int64 TotalBytes = 0;
+		bool bScanned = false;
+	};
+}
+#endif
+
+bool FTreeGenerationDiskCache::IsEnabled()
+{
+	return CVarTreeCachePersistent.GetValueOnAnyThread() != 0;
+}
+
+FTreeGeneratedDataPtr FTreeGenerationDiskCache::Load(const FSHAHash& Key)
+{
+	TArray<uint8> Blob;
+
+#if WITH_EDITOR
+	if (!GetDerivedDataCacheRef().GetSynchronous(*GetDerivedDataKey(Key), Blob, TEXT("LSystemTree")))
+	{
+		return FTreeGeneratedDataPtr();
+	}
+#else
+	const FString BlobPath = GetBlobPath(Key);
+	if (!FPaths::FileExists(BlobPath) || !FFileHelper::LoadFileToArray(Blob, *BlobPath))
+	{
+		return FTreeGeneratedDataPtr();
+	}
+#endif
+
+	TSharedRef<FTreeGeneratedData, ESPMode::ThreadSafe> Data = MakeShared<FTreeGeneratedData, ESPMode::ThreadSafe>();
+	FMemoryReader Reader(Blob);
+
+	if (!Data->Serialize(Reader))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("TreeGenerationCache: Discarding stale or corrupt cached tree %s"), *Key.ToString());
+#if !WITH_EDITOR
+		IFileManager::Get().Delete(*BlobPath, false, false, true);
+		FTreeBlobIndex::Get().Remove(BlobPath);
+#endif
+		return FTreeGeneratedDataPtr();
+	}
+
+#if !WITH_EDITOR
+	FTreeBlobIndex::Get().Touch(BlobPath);
+#endif
+
+	return Data;
+}
+
+void FTreeGenerationDiskCache::StoreAsync(const FSHAHash& Key, const FTreeGeneratedDataPtr& Data)
+{
+	if (!Data.IsValid())
+	{
+		return;
+	}
+
+	// Data is immutable once published, so it can be serialized off the game thread
+	UE::Tasks::Launch(TEXT("TreeCacheStore"), [Key, Data]()
+	{
+		TArray<uint8> Blob;
+		SaveBlob(*Data, Blob);
+
+#if WITH_EDITOR
+		GetDerivedDataCacheRef().Put(*GetDerivedDataKey(Key), Blob, TEXT("LSystemTree"));
+#else
+		const FString BlobPath = GetBlobPath(Key);
+		if (FFileHelper::SaveArrayToFile(Blob, *BlobPath))
+		{
+			const int64 BudgetBytes = static_cast<int64>(FMath::Max(CVarTreeCachePersistentBudgetMB.GetValueOnAnyThread(), 0)) * 1024 * 1024;
+			FTreeBlobIndex::Get().Add(BlobPath, Blob.Num(), BudgetBytes);
+		}
+#endif
+	});
+}
+
+void FTreeGenerationDiskCache::SaveBlob(const FTreeGeneratedData& Data, TArray<uint8>& OutBlob)
+{
+	FMemoryWriter Writer(OutBlob);
+
+	// Saving never modifies the data, it only reads it
+	const_cast<FTreeGeneratedData&>(Data).Serialize(Writer);
+}
+
+#if WITH_EDITOR
+FString FTreeGenerationDiskCache::GetDerivedDataKey(const FSHAHash& Key)
+{
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("LSYSTEMTREE"),
+		*FString::Printf(TEXT("V%u"), TreeBlobVersion), *Key.ToString());
+}
+#else
+FString FTreeGenerationDiskCache::GetBlobPath(const FSHAHash& Key)
+{
+	return FPaths::ProjectSavedDir() / TEXT("LSystemTrees") / TEXT("TreeCache") / (Key.ToString() + TEXT(".ltree"));
+}
+#endif
@@ -244,6 +244,30 @@ float UTreeMath::LerpRadius(float StartRadius, float EndRadius, float T)
 	return FMath::Lerp(StartRadius, EndRadius, FMath::Clamp(T, 0.0f, 1.0f));
 }
 
+// ============================================================================
+// LOD Selection
+// ============================================================================
+
+float UTreeMath::ComputeScreenSize(float SphereRadius, float Distance, float FOVDegrees)
+{
+	// Matches ComputeBoundsScreenSize: 2 * (0.5 * ProjMatrix[0][0]) * Radius / Distance, ProjMatrix[0][0] = 1 / tan(FOV / 2)
+	const float HalfFOVRad = FMath::DegreesToRadians(FMath::Clamp(FOVDegrees, 1.0f, 179.0f) * 0.5f);
+	return SphereRadius / (FMath::Max(Distance, 1.0f) * FMath::Tan(HalfFOVRad));
+}
+
+int32 UTreeMath::SelectLODForScreenSize(const TArray<FTreeLODLevel>& LODLevels, float ScreenSize)
+{
+	int32 Selected = 0;
+	for (int32 i = 1; i < LODLevels.Num(); ++i)
+	{
+		if (ScreenSize < LODLevels[i].ScreenSize)
+		{
+			Selected = i;
+		}
+	}
+	return Selected;
+}
+
 // ============================================================================
 // Random Utilities
 // ============================================================================
@@ -0,0 +1,36 @@
+// TreeScratch.cpp
+// Per-thread reusable buffers for the generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/Utilities/TreeScratch.h"
+#include "HAL/IConsoleManager.h"
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarScratchMaxRetainedMB(
+	TEXT("LSystemTrees.Scratch.MaxRetainedMB"),
+	16,
+	TEXT("Largest intermediate buffer (in MB) kept for reuse by the next generation on the same thread.\n")
+	TEXT("Bigger buffers are freed after use. 0 disables reuse."),
+	ECVF_Default);
+
+SIZE_T FTreeScratchSettings::GetMaxRetainedBytes()
+{
+	return static_cast<SIZE_T>(FMath::Max(CVarScratchMaxRetainedMB.GetValueOnAnyThread(), 0)) * 1024 * 1024;
+}
+
+static std::atomic<uint32> ScratchTrimEpoch{0};
+
+static FAutoConsoleCommand CmdScratchTrim(
+	TEXT("LSystemTrees.Scratch.Trim"),
+	TEXT("Free the idle intermediate buffers of every thread (each thread frees its own on next use)."),
+	FConsoleCommandDelegate::CreateStatic(&FTreeScratchSettings::Trim));
+
+void FTreeScratchSettings::Trim()
+{
+	ScratchTrimEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32 FTreeScratchSettings::GetTrimEpoch()
+{
+	return ScratchTrimEpoch.load(std::memory_order_relaxed);
+}
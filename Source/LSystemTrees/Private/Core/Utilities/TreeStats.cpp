@@ -0,0 +1,28 @@
+// TreeStats.cpp
+// Stat counters for the tree generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Core/Utilities/TreeStats.h"
+
+DEFINE_STAT(STAT_LSystemTrees_LSystemStage);
+DEFINE_STAT(STAT_LSystemTrees_ApplyRules);
+DEFINE_STAT(STAT_LSystemTrees_TurtleStage);
+DEFINE_STAT(STAT_LSystemTrees_Interpret);
+DEFINE_STAT(STAT_LSystemTrees_GeometryStage);
+DEFINE_STAT(STAT_LSystemTrees_BuildMesh);
+DEFINE_STAT(STAT_LSystemTrees_ApplyMeshData);
+DEFINE_STAT(STAT_LSystemTrees_UpdateCollision);
+
+DEFINE_STAT(STAT_LSystemTrees_TreesGenerated);
+DEFINE_STAT(STAT_LSystemTrees_CacheHits);
+DEFINE_STAT(STAT_LSystemTrees_ScheduledTrees);
+DEFINE_STAT(STAT_LSystemTrees_LastLSystemMs);
+DEFINE_STAT(STAT_LSystemTrees_LastTurtleMs);
+DEFINE_STAT(STAT_LSystemTrees_LastGeometryMs);
+DEFINE_STAT(STAT_LSystemTrees_LastApplyMs);
+DEFINE_STAT(STAT_LSystemTrees_LastTotalMs);
+
+DEFINE_STAT(STAT_LSystemTrees_SymbolMemory);
+DEFINE_STAT(STAT_LSystemTrees_SkeletonMemory);
+DEFINE_STAT(STAT_LSystemTrees_MeshMemory);
+DEFINE_STAT(STAT_LSystemTrees_ScratchMemory);
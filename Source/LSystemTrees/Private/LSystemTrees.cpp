@@ -1,18 +1,24 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "LSystemTrees.h"
+#include "Core/Utilities/TreeScratch.h"
+#include "Misc/CoreDelegates.h"
 
 #define LOCTEXT_NAMESPACE "FLSystemTreesModule"
 
 void FLSystemTreesModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddStatic(&FTreeScratchSettings::Trim);
 }
 
 void FLSystemTreesModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,367 @@
+// TreeGenerationSubsystem.cpp
+// Frame-budgeted scheduling of tree generation across many components
+// Part of LSystemTrees Plugin - Phase 3
+
+#include "Subsystems/TreeGenerationSubsystem.h"
+#include "Core/Utilities/TreeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/StableSort.h"
+
+static TAutoConsoleVariable<float> CVarSchedulerApplyBudgetMs(
+	TEXT("LSystemTrees.Scheduler.ApplyBudgetMs"),
+	4.0f,
+	TEXT("Game thread time per frame for uploading scheduled trees (at least one tree is applied per frame)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSchedulerMaxInFlight(
+	TEXT("LSystemTrees.Scheduler.MaxInFlight"),
+	4,
+	TEXT("Scheduled tree pipelines running on worker threads at once."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSchedulerMaxStartsPerFrame(
+	TEXT("LSystemTrees.Scheduler.MaxStartsPerFrame"),
+	32,
+	TEXT("Queued trees taken per frame. Pipeline launches, memory cache hits and trees joining a running\n")
+	TEXT("pipeline all count, so a queue of identical or cached trees is spread over several frames too."),
+	ECVF_Default);
+
+/** Trees outside every view cone are ordered as if this many times farther away */
+static constexpr float SchedulerOutOfViewDistanceScale = 4.0f;
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+void UTreeGenerationSubsystem::EnqueueTree(UProceduralTreeComponent* Component)
+{
+	if (!Component || IsTreeScheduled(Component))
+	{
+		return;
+	}
+
+	Component->bScheduledGeneration = true;
+	Queue.Add(Component);
+}
+
+void UTreeGenerationSubsystem::DequeueTree(UProceduralTreeComponent* Component)
+{
+	if (!IsTreeScheduled(Component))
+	{
+		return;
+	}
+
+	Component->bScheduledGeneration = false;
+	Queue.Remove(Component);
+
+	Ready.RemoveAll([Component](const FReadyTree& Entry)
+	{
+		return Entry.Component == Component;
+	});
+
+	for (auto It = InFlight.CreateIterator(); It; ++It)
+	{
+		FInFlightTree& Run = It.Value();
+		Run.Followers.RemoveAll([Component](const TPair<TWeakObjectPtr<UProceduralTreeComponent>, FTreeGenerationRequest>& Follower)
+		{
+			return Follower.Key == Component;
+		});
+
+		// The leader's pipeline is being cancelled, so its result will never arrive
+		if (Run.Leader == Component)
+		{
+			RequeueFollowers(Run);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool UTreeGenerationSubsystem::IsTreeScheduled(const UProceduralTreeComponent* Component) const
+{
+	// Tracked on the component, so queueing thousands of trees stays linear
+	return Component && Component->bScheduledGeneration;
+}
+
+int32 UTreeGenerationSubsystem::GetScheduledCount() const
+{
+	int32 Count = Queue.Num() + Ready.Num();
+	for (const TPair<FSHAHash, FInFlightTree>& Pair : InFlight)
+	{
+		Count += 1 + Pair.Value.Followers.Num();
+	}
+	return Count;
+}
+
+void UTreeGenerationSubsystem::OnScheduledGenerationFinished(UProceduralTreeComponent* Component, const FTreeGenerationRequest& Request,
+                                                             const FTreeGeneratedDataPtr& Data, FTreeGenerationOutput&& Output)
+{
+	FInFlightTree Run;
+	InFlight.RemoveAndCopyValue(Request.CacheKey, Run);
+
+	if (!Data)
+	{
+		Component->bScheduledGeneration = false;
+		RequeueFollowers(Run);
+		return;
+	}
+
+	FReadyTree& Entry = Ready.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.Request = Request;
+	Entry.Data = Data;
+	if (!Output.bLoadedFromCache)
+	{
+		Entry.Output = MakeShared<FTreeGenerationOutput>(MoveTemp(Output));
+	}
+
+	// Identical inputs: everyone waiting on this run displays the same shared data
+	for (TPair<TWeakObjectPtr<UProceduralTreeComponent>, FTreeGenerationRequest>& Follower : Run.Followers)
+	{
+		FReadyTree& FollowerEntry = Ready.AddDefaulted_GetRef();
+		FollowerEntry.Component = Follower.Key;
+		FollowerEntry.Request = MoveTemp(Follower.Value);
+		FollowerEntry.Data = Data;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("TreeGenerationSubsystem: Pipeline finished for %d tree(s)"), 1 + Run.Followers.Num());
+}
+
+// ============================================================================
+// USubsystem / FTickableGameObject Interface
+// ============================================================================
+
+void UTreeGenerationSubsystem::Deinitialize()
+{
+	// Components still running finish (or are cancelled) on their own and apply directly
+	auto ClearScheduled = [](const TWeakObjectPtr<UProceduralTreeComponent>& Component)
+	{
+		if (Component.IsValid())
+		{
+			Component->bScheduledGeneration = false;
+		}
+	};
+
+	for (const TWeakObjectPtr<UProceduralTreeComponent>& Component : Queue)
+	{
+		ClearScheduled(Component);
+	}
+	for (const FReadyTree& Entry : Ready)
+	{
+		ClearScheduled(Entry.Component);
+	}
+	for (const TPair<FSHAHash, FInFlightTree>& Pair : InFlight)
+	{
+		ClearScheduled(Pair.Value.Leader);
+		for (const TPair<TWeakObjectPtr<UProceduralTreeComponent>, FTreeGenerationRequest>& Follower : Pair.Value.Followers)
+		{
+			ClearScheduled(Follower.Key);
+		}
+	}
+
+	Queue.Empty();
+	InFlight.Empty();
+	Ready.Empty();
+
+	Super::Deinitialize();
+}
+
+void UTreeGenerationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Components garbage collected without being destroyed
+	Queue.RemoveAll([](const TWeakObjectPtr<UProceduralTreeComponent>& Component)
+	{
+		return !Component.IsValid();
+	});
+
+	for (auto It = InFlight.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Leader.IsValid())
+		{
+			RequeueFollowers(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Queue.Num() > 0)
+	{
+		SortQueue();
+		LaunchQueued();
+	}
+
+	ApplyReady();
+
+	SET_DWORD_STAT(STAT_LSystemTrees_ScheduledTrees, GetScheduledCount());
+}
+
+TStatId UTreeGenerationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTreeGenerationSubsystem, STATGROUP_LSystemTrees);
+}
+
+bool UTreeGenerationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Only worlds that BeginPlay; editor worlds generate directly
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+void UTreeGenerationSubsystem::SortQueue()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGenerationSubsystem::SortQueue);
+
+	struct FView
+	{
+		FVector Location;
+		FVector Direction;
+		float CosHalfFOV;
+	};
+
+	TArray<FView, TInlineAllocator<4>> Views;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			const APlayerCameraManager* Camera = PlayerController->PlayerCameraManager;
+			Views.Add({ Camera->GetCameraLocation(), Camera->GetCameraRotation().Vector(),
+			            FMath::Cos(FMath::DegreesToRadians(Camera->GetFOVAngle() * 0.5f)) });
+		}
+	}
+
+	// Nothing to prioritize by - keep the enqueue order
+	if (Views.Num() == 0)
+	{
+		return;
+	}
+
+	const float OutOfViewScaleSquared = FMath::Square(SchedulerOutOfViewDistanceScale);
+
+	TArray<TPair<float, TWeakObjectPtr<UProceduralTreeComponent>>> Priorities;
+	Priorities.Reserve(Queue.Num());
+
+	for (const TWeakObjectPtr<UProceduralTreeComponent>& Component : Queue)
+	{
+		const FVector TreeLocation = Component->GetComponentLocation();
+
+		float Priority = TNumericLimits<float>::Max();
+		for (const FView& View : Views)
+		{
+			const FVector ToTree = TreeLocation - View.Location;
+			const float DistanceSquared = ToTree.SizeSquared();
+			const bool bInView = FVector::DotProduct(ToTree.GetSafeNormal(), View.Direction) >= View.CosHalfFOV;
+			Priority = FMath::Min(Priority, bInView ? DistanceSquared : DistanceSquared * OutOfViewScaleSquared);
+		}
+
+		Priorities.Emplace(Priority, Component);
+	}
+
+	Algo::StableSortBy(Priorities, [](const TPair<float, TWeakObjectPtr<UProceduralTreeComponent>>& Entry)
+	{
+		return Entry.Key;
+	});
+
+	for (int32 i = 0; i < Queue.Num(); ++i)
+	{
+		Queue[i] = Priorities[i].Value;
+	}
+}
+
+void UTreeGenerationSubsystem::LaunchQueued()
+{
+	const int32 MaxInFlight = FMath::Max(CVarSchedulerMaxInFlight.GetValueOnGameThread(), 1);
+
+	// Every taken tree costs a request hash and, for hits and followers, a later upload
+	const int32 MaxTaken = FMath::Min(FMath::Max(CVarSchedulerMaxStartsPerFrame.GetValueOnGameThread(), 1), Queue.Num());
+
+	int32 NumTaken = 0;
+	while (InFlight.Num() < MaxInFlight && NumTaken < MaxTaken)
+	{
+		UProceduralTreeComponent* Component = Queue[NumTaken++].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		FTreeGenerationRequest Request;
+		Component->BuildGenerationRequest(Request);
+
+		// Same inputs already running - wait for that result instead of generating twice
+		if (FInFlightTree* Run = InFlight.Find(Request.CacheKey))
+		{
+			Run->Followers.Emplace(Component, MoveTemp(Request));
+			continue;
+		}
+
+		// Memory only; the persistent cache is read by the launched pipeline on a worker
+		if (FTreeGeneratedDataPtr Cached = Component->FindCachedGeneration(Request, false))
+		{
+			FReadyTree& Entry = Ready.AddDefaulted_GetRef();
+			Entry.Component = Component;
+			Entry.Request = MoveTemp(Request);
+			Entry.Data = Cached;
+			continue;
+		}
+
+		InFlight.Add(Request.CacheKey).Leader = Component;
+		Component->LaunchAsyncGeneration(Request, true);
+	}
+
+	Queue.RemoveAt(0, NumTaken, false);
+}
+
+void UTreeGenerationSubsystem::ApplyReady()
+{
+	if (Ready.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(TreeGenerationSubsystem::ApplyReady);
+
+	const double BudgetSeconds = FMath::Max(CVarSchedulerApplyBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 NumApplied = 0;
+	while (Ready.Num() > 0)
+	{
+		// Taken out first: OnTreeGenerated listeners may schedule or cancel other trees
+		FReadyTree Entry = MoveTemp(Ready[0]);
+		Ready.RemoveAt(0, 1, false);
+
+		if (UProceduralTreeComponent* Component = Entry.Component.Get())
+		{
+			Component->bScheduledGeneration = false;
+			Component->ApplyGeneratedData(Entry.Request, Entry.Data, Entry.Output.Get());
+			++NumApplied;
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("TreeGenerationSubsystem: Applied %d tree(s) in %.2fms, %d waiting"),
+	       NumApplied, (FPlatformTime::Seconds() - StartTime) * 1000.0, Ready.Num());
+}
+
+void UTreeGenerationSubsystem::RequeueFollowers(FInFlightTree& Run)
+{
+	// They were already next in line, so they go to the front
+	TArray<TWeakObjectPtr<UProceduralTreeComponent>> Requeued;
+	for (const TPair<TWeakObjectPtr<UProceduralTreeComponent>, FTreeGenerationRequest>& Follower : Run.Followers)
+	{
+		Requeued.Add(Follower.Key);
+	}
+	Queue.Insert(Requeued, 0);
+
+	Run.Followers.Reset();
+}
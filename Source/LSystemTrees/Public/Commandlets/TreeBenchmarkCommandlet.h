@@ -0,0 +1,42 @@
+// TreeBenchmarkCommandlet.h
+// Command line driver for the generation pipeline benchmarks
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TreeBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks every built-in preset across iteration counts and seeds (see FTreeBenchmark).
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=TreeBenchmark [options]
+ *
+ * Options:
+ *   -Presets=Birch,Oak      Presets to run (default: all)
+ *   -Iterations=6,8,10      Iteration counts (default: each preset's own)
+ *   -Seeds=1,2,3            Seeds (default: 1,2,3)
+ *   -Repeats=3              Runs per case, fastest kept (default: 3)
+ *   -MaxLength=10000000     Generator string limit
+ *   -Output=Path            Output file without extension (default: Saved/LSystemTrees/Benchmarks/<timestamp>)
+ *   -Baseline=Path.json     Compare against an earlier run and fail on regressions
+ *   -Tolerance=0.1          Allowed slowdown per stage (fraction)
+ *
+ * Returns 0 on success, 1 if a stage regressed beyond the tolerance, 2 on errors.
+ */
+UCLASS()
+class LSYSTEMTREES_API UTreeBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UTreeBenchmarkCommandlet();
+
+	// ========================================================================
+	// UCommandlet Interface
+	// ========================================================================
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,128 @@
+// ProceduralForestComponent.h
+// Instanced rendering of baked procedural trees
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Core/LSystem/LSystemTypes.h"
+#include "ProceduralForestComponent.generated.h"
+
+// Forward declarations
+class UProceduralTreeComponent;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * Renders many trees through hierarchical instanced static meshes.
+ *
+ * Every (preset, seed) variant is generated and baked to a UStaticMesh once, then all
+ * trees of that variant become instances of a single HISM component. A preset is any
+ * UProceduralTreeComponent whose L-System/turtle/geometry settings and materials describe
+ * the tree; its own mesh is never modified.
+ *
+ * Usage:
+ *   1. Add a hidden UProceduralTreeComponent as the preset and configure it
+ *   2. Add this component and call AddTreeInstance(Preset, Seed, Transform) per tree
+ *   3. Call ClearForest after changing a preset to rebake its variants
+ */
+UCLASS(ClassGroup = (Procedural), meta = (BlueprintSpawnableComponent, DisplayName = "Procedural Forest"))
+class LSYSTEMTREES_API UProceduralForestComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UProceduralForestComponent(const FObjectInitializer& ObjectInitializer);
+
+	// ========================================================================
+	// Forest Settings
+	// ========================================================================
+
+	/** Options used when baking each variant */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Forest",
+		meta = (DisplayName = "Bake Settings", ShowOnlyInnerProperties))
+	FTreeBakeSettings BakeSettings;
+
+	// ========================================================================
+	// Instances
+	// ========================================================================
+
+	/**
+	 * Add one tree instance, baking the variant on first use.
+	 * @param Preset Tree component providing the generation settings
+	 * @param Seed Random seed of the variant
+	 * @param InstanceTransform Transform of the tree
+	 * @param bWorldSpace True if the transform is in world space (relative to this component otherwise)
+	 * @return Instance index within the variant's HISM, or INDEX_NONE on failure
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Forest",
+		meta = (DisplayName = "Add Tree Instance"))
+	int32 AddTreeInstance(UProceduralTreeComponent* Preset, int32 Seed,
+	                      const FTransform& InstanceTransform, bool bWorldSpace = false);
+
+	/**
+	 * Add many instances of one variant in a single batch (one HISM tree rebuild).
+	 * @return Number of instances added
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Forest",
+		meta = (DisplayName = "Add Tree Instances"))
+	int32 AddTreeInstances(UProceduralTreeComponent* Preset, int32 Seed,
+	                       const TArray<FTransform>& InstanceTransforms, bool bWorldSpace = false);
+
+	/** Remove all instances and baked variants */
+	UFUNCTION(BlueprintCallable, Category = "Forest",
+		meta = (DisplayName = "Clear Forest"))
+	void ClearForest();
+
+	/** Get the HISM rendering a variant (baked on demand) */
+	UFUNCTION(BlueprintCallable, Category = "Forest",
+		meta = (DisplayName = "Get Variant Component"))
+	UHierarchicalInstancedStaticMeshComponent* GetVariantComponent(UProceduralTreeComponent* Preset, int32 Seed);
+
+	// ========================================================================
+	// Statistics
+	// ========================================================================
+
+	/** Get number of baked (preset, seed) variants */
+	UFUNCTION(BlueprintPure, Category = "Forest|Statistics")
+	int32 GetVariantCount() const;
+
+	/** Get total number of tree instances */
+	UFUNCTION(BlueprintPure, Category = "Forest|Statistics")
+	int32 GetInstanceCount() const;
+
+protected:
+	// ========================================================================
+	// UActorComponent Interface
+	// ========================================================================
+
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+private:
+	/** Identifies one baked variant */
+	struct FVariantKey
+	{
+		TWeakObjectPtr<UProceduralTreeComponent> Preset;
+		int32 Seed;
+
+		bool operator==(const FVariantKey& Other) const
+		{
+			return Preset == Other.Preset && Seed == Other.Seed;
+		}
+
+		friend uint32 GetTypeHash(const FVariantKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Preset), GetTypeHash(Key.Seed));
+		}
+	};
+
+	/** Find or bake the HISM for a variant */
+	UHierarchicalInstancedStaticMeshComponent* FindOrCreateVariant(UProceduralTreeComponent* Preset, int32 Seed);
+
+	/** Variant -> index into VariantComponents */
+	TMap<FVariantKey, int32> VariantIndices;
+
+	/** One HISM per baked variant */
+	UPROPERTY(Transient)
+	TArray<UHierarchicalInstancedStaticMeshComponent*> VariantComponents;
+};
@@ -7,17 +7,94 @@
 #include "CoreMinimal.h"
 #include "ProceduralMeshComponent.h"
 #include "Core/LSystem/LSystemTypes.h"
+#include "Core/Utilities/TreeGenerationCache.h"
 #include "ProceduralTreeComponent.generated.h"
 
 // Forward declarations
 class ULSystemGenerator;
 class UTurtleInterpreter;
 class UTreeGeometry;
+class UStaticMesh;
+class UHierarchicalInstancedStaticMeshComponent;
+class UStaticMeshComponent;
+class UBodySetup;
+class UTreeGenerationSubsystem;
+struct FTreeGenerationTask;
 
 // Delegate for tree generation events
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTreeGenerated, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTreeGenerationProgress, int32, CurrentStep, int32, TotalSteps);
 
+// ============================================================================
+// Generation Pipeline Types
+// ============================================================================
+
+/**
+ * Snapshot of everything the generation pipeline reads from the component.
+ * Taken on the game thread so worker stages never touch component properties.
+ */
+struct LSYSTEMTREES_API FTreeGenerationRequest
+{
+	FString Axiom;
+	TArray<FLSystemRule> Rules;
+	int32 Iterations = 0;
+
+	/** Effective seed (already randomized if bRandomizeSeed was set) */
+	int32 Seed = 0;
+
+	/** Store and look up the result in the persistent cache (false for randomized seeds, which never recur) */
+	bool bPersistent = false;
+
+	bool bStreamFinalIteration = false;
+
+	/** Turtle config with seed and leaf size applied */
+	FTurtleConfig TurtleConfig;
+
+	FTreeGeometryConfig GeometryConfig;
+	TArray<FTreeLODLevel> LODLevels;
+
+	/** Content hash of the L-System stage inputs (axiom, rules, iterations, seed) */
+	FSHAHash LSystemKey;
+
+	/** Content hash of the turtle stage inputs (LSystemKey + turtle settings) */
+	FSHAHash TurtleKey;
+
+	/** Content hash of all inputs (TurtleKey + geometry settings except collision), keys the generation cache */
+	FSHAHash CacheKey;
+
+	/** Hash the inputs of every stage (call after changing any field above) */
+	void ComputeKeys();
+};
+
+/** Data produced by the generation pipeline, moved into the component caches on completion */
+struct LSYSTEMTREES_API FTreeGenerationOutput
+{
+	/** Final L-System symbols (empty when the final iteration was streamed) */
+	FLSystemSymbolBuffer Symbols;
+
+	/** Turtle output, written in place by the interpreter and read directly by the geometry stage */
+	FTreeSkeleton Skeleton;
+
+	TArray<FTreeMeshData> LODs;
+
+	/** True once Symbols holds the final iteration (generated or reused) */
+	bool bHasSymbols = false;
+
+	/** True if segments/leaves were already produced (while streaming, or reused) */
+	bool bInterpreted = false;
+
+	/** True if the whole tree was loaded from the persistent cache instead (no stage ran) */
+	bool bLoadedFromCache = false;
+
+	/** Stage times in milliseconds (0 for reused stages) */
+	float LSystemTimeMs = 0.0f;
+	float TurtleTimeMs = 0.0f;
+	float GeometryTimeMs = 0.0f;
+
+	/** Reason for failure (empty on success) */
+	FString ErrorMessage;
+};
+
 /**
  * Procedural tree component that generates 3D tree meshes using L-Systems.
  *
@@ -109,25 +186,103 @@ public:
 		meta = (DisplayName = "LOD Levels"))
 	TArray<FTreeLODLevel> LODLevels;
 
+	/**
+	 * Automatically select the LOD from the tree's screen size (uses FTreeLODLevel::ScreenSize).
+	 * Off by default: while enabled the component ticks every LODUpdateInterval, in editor worlds too.
+	 * Calling SetLODLevel turns it off so the manual choice is not overwritten on the next evaluation;
+	 * use SetAutoLOD to turn it back on.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetAutoLOD, Category = "Tree|LOD",
+		meta = (DisplayName = "Auto LOD"))
+	bool bAutoLOD;
+
+	/**
+	 * Seconds between automatic LOD evaluations.
+	 * Each evaluation replaces the active LOD, including one picked with SetLODLevel while auto LOD was on.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|LOD",
+		meta = (ClampMin = "0", UIMax = "1", DisplayName = "LOD Update Interval", EditCondition = "bAutoLOD"))
+	float LODUpdateInterval;
+
 	/** Whether to automatically generate tree on component creation */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Generation",
 		meta = (DisplayName = "Generate On Start"))
 	bool bGenerateOnStart;
 
+	/**
+	 * Feed the final L-System iteration straight into the turtle instead of building the full string.
+	 * Lowers peak memory for deep iterations; GetLSystemString() returns an empty string when enabled.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Generation",
+		meta = (DisplayName = "Stream Final Iteration"))
+	bool bStreamFinalIteration;
+
+	/**
+	 * Share generated trees through the process-wide cache (LSystemTrees.TreeCache.BudgetMB).
+	 * Components with identical inputs then skip the pipeline and reference the same data.
+	 * Trees with a fixed seed are also persisted across sessions unless LSystemTrees.TreeCache.Persistent
+	 * is 0 (randomized seeds are never persisted, they would not be requested again).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Generation",
+		meta = (DisplayName = "Use Generation Cache"))
+	bool bUseGenerationCache;
+
+	/**
+	 * Generate on start through the world's UTreeGenerationSubsystem instead of in BeginPlay.
+	 * Trees then start nearest-first on worker threads and are applied within a per-frame budget.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Generation",
+		meta = (DisplayName = "Use Generation Scheduler", EditCondition = "bGenerateOnStart"))
+	bool bUseGenerationScheduler;
+
+	/** Mesh shown while a scheduled generation is pending and no tree is displayed yet (none if not set) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Generation",
+		meta = (DisplayName = "Placeholder Mesh"))
+	UStaticMesh* PlaceholderMesh;
+
 	// ========================================================================
 	// Materials
 	// ========================================================================
 
-	/** Material for tree bark (applied to mesh section 0) */
+	/** Material for tree bark (applied to the branch section of every LOD) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Materials",
 		meta = (DisplayName = "Bark Material"))
 	UMaterialInterface* BarkMaterial;
 
-	/** Material for leaves (applied to mesh section 1) */
+	/** Material for leaves (applied to the leaf section of every LOD) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Materials",
 		meta = (DisplayName = "Leaf Material"))
 	UMaterialInterface* LeafMaterial;
 
+	// ========================================================================
+	// Leaf Rendering
+	// ========================================================================
+
+	/**
+	 * Render leaves as instances of one shared card mesh instead of quads in every LOD mesh.
+	 * LOD meshes then only hold branches; leaves are shown for LODs with bIncludeLeaves and
+	 * culled by Leaf Cull Distance. Baked static meshes contain no leaves in this mode.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Leaves",
+		meta = (DisplayName = "Instanced Leaves"))
+	bool bInstancedLeaves;
+
+	/**
+	 * Card mesh shared by all leaf instances (centered, facing +Z, leaf height along X).
+	 * Scaled per leaf from its bounds to the leaf size. Uses the engine plane if not set.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Leaves",
+		meta = (DisplayName = "Leaf Card Mesh", EditCondition = "bInstancedLeaves"))
+	UStaticMesh* LeafCardMesh;
+
+	/**
+	 * Distance beyond which leaf instances are culled (0 = never). Instances fade over the
+	 * last 20% of it if the leaf material uses PerInstanceFadeAmount, otherwise they pop.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tree|Leaves",
+		meta = (ClampMin = "0", DisplayName = "Leaf Cull Distance", EditCondition = "bInstancedLeaves"))
+	float LeafCullDistance;
+
 	// ========================================================================
 	// Events
 	// ========================================================================
@@ -152,6 +307,40 @@ public:
 		meta = (DisplayName = "Generate Tree"))
 	void GenerateTree();
 
+	/**
+	 * Generate the tree on the task graph without blocking the game thread.
+	 * L-System rewriting, turtle interpretation and LOD mesh building run as chained worker tasks;
+	 * only applying the finished mesh happens on the game thread. OnTreeGenerated fires on completion
+	 * (OnGenerationProgress is not broadcast). Starting a new generation cancels the pending one.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Generation",
+		meta = (DisplayName = "Generate Tree Async"))
+	void GenerateTreeAsync();
+
+	/**
+	 * Queue the tree in the world's UTreeGenerationSubsystem (budgeted, nearest first).
+	 * Falls back to GenerateTreeAsync in worlds without the subsystem (editor worlds).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Generation",
+		meta = (DisplayName = "Request Scheduled Generation"))
+	void RequestScheduledGeneration();
+
+	/**
+	 * Cancel a pending GenerateTreeAsync call or scheduled generation.
+	 * The current mesh is kept and OnTreeGenerated does not fire.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Generation",
+		meta = (DisplayName = "Cancel Tree Generation"))
+	void CancelTreeGeneration();
+
+	/**
+	 * Check if an async generation is pending.
+	 * @return True while GenerateTreeAsync work is in flight or the tree is scheduled
+	 */
+	UFUNCTION(BlueprintPure, Category = "Tree|Generation",
+		meta = (DisplayName = "Is Generating Tree"))
+	bool IsGeneratingTree() const;
+
 	/**
 	 * Regenerate the tree with a specific random seed.
 	 * @param Seed Random seed for reproducible results
@@ -161,7 +350,8 @@ public:
 	void RegenerateWithSeed(int32 Seed);
 
 	/**
-	 * Clear the current tree mesh.
+	 * Clear the current tree mesh and release its generated data.
+	 * The next generation runs every stage (or comes from the generation cache).
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tree|Generation",
 		meta = (DisplayName = "Clear Tree"))
@@ -173,12 +363,22 @@ public:
 
 	/**
 	 * Set the active LOD level manually.
+	 * All LODs are uploaded once at generation time, so switching only toggles section visibility.
+	 * Turns off bAutoLOD, otherwise the next automatic evaluation would replace this choice.
 	 * @param LODIndex Index of LOD level to display (0 = highest detail)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Tree|LOD",
 		meta = (DisplayName = "Set LOD Level"))
 	void SetLODLevel(int32 LODIndex);
 
+	/**
+	 * Enable or disable automatic LOD selection (starts or stops the LOD tick).
+	 * @param bEnable Whether the LOD follows the tree's screen size
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|LOD",
+		meta = (DisplayName = "Set Auto LOD"))
+	void SetAutoLOD(bool bEnable);
+
 	/**
 	 * Get the currently active LOD level.
 	 * @return Current LOD index
@@ -195,13 +395,39 @@ public:
 		meta = (DisplayName = "Get LOD Count"))
 	int32 GetLODCount() const;
 
+	// ========================================================================
+	// Baking
+	// ========================================================================
+
+	/**
+	 * Bake the generated LODs into a UStaticMesh for instanced rendering.
+	 * @param Settings Bake options (Nanite, collision)
+	 * @param Outer Outer of the new mesh (transient package if null)
+	 * @return The baked mesh, or null if no tree has been generated
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Baking",
+		meta = (DisplayName = "Bake To Static Mesh"))
+	UStaticMesh* BakeToStaticMesh(const FTreeBakeSettings& Settings, UObject* Outer = nullptr);
+
+	/**
+	 * Generate this tree's configuration with a given seed and bake it, without touching
+	 * the component's own mesh. Used to build one shared mesh per (preset, seed) variant.
+	 * @param Seed Random seed of the variant
+	 * @param Settings Bake options (Nanite, collision)
+	 * @param Outer Outer of the new mesh (transient package if null)
+	 * @return The baked mesh, or null if generation failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Baking",
+		meta = (DisplayName = "Bake Static Mesh For Seed"))
+	UStaticMesh* BakeStaticMeshForSeed(int32 Seed, const FTreeBakeSettings& Settings, UObject* Outer = nullptr);
+
 	// ========================================================================
 	// Statistics
 	// ========================================================================
 
 	/**
 	 * Get the generated L-System string.
-	 * @return The L-System string (can be very long!)
+	 * @return The L-System string (can be very long!), empty if the final iteration was streamed
 	 */
 	UFUNCTION(BlueprintPure, Category = "Tree|Statistics")
 	FString GetLSystemString() const;
@@ -234,6 +460,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Tree|Statistics")
 	int32 GetTriangleCount() const;
 
+	/**
+	 * Get the per-stage timings, counts and memory of the displayed tree's generation.
+	 * The same numbers are published to "stat LSystemTrees".
+	 * @return Breakdown of the last successful generation
+	 */
+	UFUNCTION(BlueprintPure, Category = "Tree|Statistics")
+	FTreeGenerationBreakdown GetLastGenerationBreakdown() const;
+
 	// ========================================================================
 	// Debug
 	// ========================================================================
@@ -253,11 +487,21 @@ protected:
 
 	virtual void OnComponentCreated() override;
 	virtual void BeginPlay() override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+	                           FActorComponentTickFunction* ThisTickFunction) override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
+	// ========================================================================
+	// UPrimitiveComponent Interface
+	// ========================================================================
+
+	/** Capsule collision replaces the procedural mesh's triangle body setup */
+	virtual UBodySetup* GetBodySetup() override;
+
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
@@ -268,12 +512,89 @@ protected:
 	/** Create and configure internal generator objects */
 	void InitializeGenerators();
 
-	/** Apply mesh data to the procedural mesh component */
-	void ApplyMeshData(const FTreeMeshData& MeshData);
+	/** Snapshot the current settings for the generation pipeline (resolves the random seed) */
+	void BuildGenerationRequest(FTreeGenerationRequest& OutRequest);
+
+	/** Publish pipeline output (to the generation cache too), display LOD 0 and broadcast success */
+	void ApplyGenerationOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output);
+
+	/** Move pipeline output into shared data and publish it to the memory and persistent caches */
+	FTreeGeneratedDataPtr PublishGenerationOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output) const;
+
+	/**
+	 * Display a generated tree, remember the request's stage keys and broadcast success.
+	 * @param Output Pipeline run that produced Data, for its stage times (null for cache hits)
+	 */
+	void ApplyGeneratedData(const FTreeGenerationRequest& Request, const FTreeGeneratedDataPtr& Data,
+	                        const FTreeGenerationOutput* Output = nullptr);
+
+	/** Remove LastGenerationBreakdown from the memory stats and reset it */
+	void ReleaseGenerationBreakdown();
+
+	/** Fill LastGenerationBreakdown for newly displayed data and update the memory stats */
+	void UpdateGenerationBreakdown(const FTreeGenerationOutput* Output, double ApplyTimeMs);
+
+	/** Copy the displayed tree's results for every stage whose inputs are unchanged into Output */
+	void PrepareIncrementalOutput(const FTreeGenerationRequest& Request, FTreeGenerationOutput& Output) const;
+
+	/**
+	 * Look up a request in the memory cache (null on miss or when the cache is not used).
+	 * @param bLoadPersistent Also try the persistent cache, which blocks on disk IO (synchronous paths only;
+	 *                        async generation loads it on a worker before running the stages)
+	 */
+	FTreeGeneratedDataPtr FindCachedGeneration(const FTreeGenerationRequest& Request, bool bLoadPersistent) const;
+
+	/** Run the pipeline stages of a request on worker tasks (bScheduled: hand the result to the scheduler) */
+	void LaunchAsyncGeneration(const FTreeGenerationRequest& Request, bool bScheduled);
+
+	/** Stop the in-flight async pipeline without touching the scheduler queue */
+	void CancelActiveGeneration();
+
+	/** Game thread completion of an async generation */
+	void FinishAsyncGeneration(const TSharedPtr<FTreeGenerationTask, ESPMode::ThreadSafe>& Task);
+
+	/** Show the placeholder mesh (only while no tree is displayed) or hide it */
+	void UpdatePlaceholder(bool bShow);
+
+	/** Scheduler of the owning world (null outside game worlds) */
+	UTreeGenerationSubsystem* GetGenerationScheduler() const;
+
+	/**
+	 * Upload one LOD into its section pair (LODIndex * FTreeMeshData::NumSections + section).
+	 * Sections whose topology matches the uploaded one are updated in place instead of recreated.
+	 */
+	void ApplyMeshData(int32 LODIndex, const FTreeMeshData& MeshData);
+
+	/** Upload every cached LOD and show only the current one */
+	void ApplyAllLODs();
+
+	/** Show the current LOD's sections and hide all others */
+	void UpdateLODVisibility();
+
+	/** Select the LOD from the closest view's screen size */
+	void UpdateAutoLOD();
+
+	/** Switch the displayed LOD without touching bAutoLOD */
+	void ApplyLODLevel(int32 LODIndex);
+
+	/** Enable ticking only while automatic LOD selection has something to switch */
+	void UpdateAutoLODTick();
+
+	/** Check if a mesh section already holds exactly this index buffer with this collision setting */
+	bool HasSectionTopology(int32 SectionIndex, const FTreeMeshSectionData& Section, bool bEnableCollision);
 
 	/** Apply materials to mesh sections */
 	void ApplyMaterials();
 
+	/** Rebuild the leaf instances from the cached skeleton (clears them when not instancing) */
+	void UpdateLeafInstances();
+
+	/** Card mesh used for instanced leaves */
+	UStaticMesh* GetLeafCardMesh() const;
+
+	/** Rebuild the capsule body setup from the cached skeleton and recreate the physics state */
+	void UpdateCapsuleCollision(const FTreeGeometryConfig& Config);
+
 private:
 	// ========================================================================
 	// Internal State
@@ -291,18 +612,54 @@ private:
 	UPROPERTY(Transient)
 	UTreeGeometry* GeometryBuilder;
 
-	/** Cached LOD mesh data */
-	TArray<FTreeMeshData> CachedLODs;
+	/** Leaf instances when bInstancedLeaves is set (created on demand) */
+	UPROPERTY(Transient)
+	UHierarchicalInstancedStaticMeshComponent* LeafInstances;
+
+	/** Shows PlaceholderMesh while a scheduled generation is pending (created on demand) */
+	UPROPERTY(Transient)
+	UStaticMeshComponent* PlaceholderComponent;
+
+	/** Simple collision fitted to the branches (created on demand) */
+	UPROPERTY(Transient)
+	UBodySetup* CapsuleBodySetup;
+
+	/** Collision of the displayed tree (from its request's geometry config) */
+	bool bCapsuleCollision;
+	bool bTriangleCollision;
 
 	/** Currently displayed LOD index */
 	int32 CurrentLODIndex;
 
-	/** Cached L-System string */
-	FString CachedLSystemString;
+	/**
+	 * Generated symbols, segments, leaves and LOD meshes (never null).
+	 * Shared with the generation cache and every component with identical inputs.
+	 */
+	FTreeGeneratedDataPtr CachedData;
+
+	/** Stage keys of the displayed tree (drive incremental regeneration) */
+	FSHAHash AppliedLSystemKey;
+	FSHAHash AppliedTurtleKey;
+	FSHAHash AppliedCacheKey;
+
+	/** Effective seed of the displayed tree */
+	int32 AppliedSeed;
+
+	/** Cost of the displayed tree's generation (its byte counts are what this component adds to the memory stats) */
+	FTreeGenerationBreakdown LastGenerationBreakdown;
+
+	/** Reuse AppliedSeed for the next request even with bRandomizeSeed (editor property edits) */
+	bool bRetainSeed;
+
+	/** Queued, running or waiting to be applied in UTreeGenerationSubsystem (maintained by the subsystem) */
+	bool bScheduledGeneration;
+
+	/** Pending async generation (null when idle) */
+	TSharedPtr<FTreeGenerationTask, ESPMode::ThreadSafe> ActiveGeneration;
 
-	/** Cached branch segments */
-	TArray<FBranchSegment> CachedSegments;
+	/** Starts, dedupes and applies scheduled generations through the internal pipeline methods */
+	friend class UTreeGenerationSubsystem;
 
-	/** Cached leaf data */
-	TArray<FLeafData> CachedLeaves;
+	/** Inspects generation requests and scheduling state */
+	friend class ATestLSystemGenerator;
 };
@@ -7,14 +7,126 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Core/LSystem/LSystemTypes.h"
+#include "Tasks/Task.h"
 #include "LSystemGenerator.generated.h"
 
-// Forward declarations
-class FLSystemAsyncTask;
-
 // Log category
 DECLARE_LOG_CATEGORY_EXTERN(LogLSystem, Log, All);
 
+// ============================================================================
+// Compiled Rule Table
+// ============================================================================
+
+/** A single weighted choice inside a context bucket */
+struct FLSystemRuleChoice
+{
+	/** The rule applied when this choice is selected */
+	const FLSystemRule* Rule;
+
+	/** Running sum of probabilities up to and including this choice */
+	float CumulativeProbability;
+
+	/** Offset of the compiled successor in FLSystemRuleTable::SuccessorSymbols */
+	int32 SuccessorOffset;
+
+	/** Number of symbols in the compiled successor */
+	int32 SuccessorLength;
+
+	/** Cached Rule->IsContextSensitive() for statistics */
+	bool bContextSensitive;
+};
+
+/**
+ * All rules of one predecessor that share the same left/right context.
+ * A bucket is selected by context, then one of its choices is picked stochastically.
+ */
+struct FLSystemRuleBucket
+{
+	/** Required left context (0 = any) */
+	uint8 LeftContext;
+
+	/** Required right context (0 = any) */
+	uint8 RightContext;
+
+	/** Number of context characters required (0-2) */
+	int32 Specificity;
+
+	/** Index of the first choice in FLSystemRuleTable::Choices */
+	int32 FirstChoice;
+
+	/** Number of choices in this bucket */
+	int32 NumChoices;
+
+	/** Sum of probabilities of all choices in this bucket */
+	float TotalProbability;
+
+	/** Check if this bucket applies to the given neighbours */
+	bool Matches(uint8 InLeftContext, uint8 InRightContext) const
+	{
+		return (LeftContext == 0 || LeftContext == InLeftContext) &&
+		       (RightContext == 0 || RightContext == InRightContext);
+	}
+};
+
+/** Dispatch entry for a single predecessor symbol */
+struct FLSystemSymbolEntry
+{
+	/** Index into FLSystemRuleTable::Choices when the symbol has exactly one context-free rule (fast path), else INDEX_NONE */
+	int32 DeterministicChoice;
+
+	/** Index of the first bucket in FLSystemRuleTable::Buckets (sorted by specificity, descending) */
+	int32 FirstBucket;
+
+	/** Number of buckets for this symbol (0 = no rule, symbol is copied unchanged) */
+	int32 NumBuckets;
+
+	/** Shortest possible output for this symbol (1 when it can be copied unchanged) */
+	int32 MinOutputLength;
+
+	/** Longest possible output for this symbol */
+	int32 MaxOutputLength;
+};
+
+/**
+ * Flat, symbol-indexed form of the rule set.
+ * Built from RuleLookup so the rewrite loop never hashes or allocates per symbol.
+ * Successors are stored as symbol bytes so they can be appended with a single copy.
+ */
+struct FLSystemRuleTable
+{
+	/** Number of directly indexed symbols */
+	static constexpr int32 NumSymbols = 256;
+
+	/** One entry per symbol value */
+	TArray<FLSystemSymbolEntry> Entries;
+
+	/** Context buckets, grouped per symbol */
+	TArray<FLSystemRuleBucket> Buckets;
+
+	/** Weighted choices, grouped per bucket */
+	TArray<FLSystemRuleChoice> Choices;
+
+	/** Successor symbols of all choices, back to back */
+	TArray<uint8> SuccessorSymbols;
+
+	/** Clear the table back to "no rules" */
+	void Reset()
+	{
+		Entries.SetNumUninitialized(NumSymbols);
+		for (FLSystemSymbolEntry& Entry : Entries)
+		{
+			Entry.DeterministicChoice = INDEX_NONE;
+			Entry.FirstBucket = 0;
+			Entry.NumBuckets = 0;
+			Entry.MinOutputLength = 1;
+			Entry.MaxOutputLength = 1;
+		}
+		Buckets.Reset();
+		Choices.Reset();
+		SuccessorSymbols.Reset();
+	}
+};
+
 /**
  * L-System string generator with stochastic and context-sensitive rule support.
  *
@@ -205,6 +317,60 @@ public:
 		meta = (DisplayName = "Generate String"))
 	FString GenerateString(int32 Iterations);
 
+	/**
+	 * Native generation path (C++ only).
+	 * Same as Generate, but the result only carries Symbols/SymbolHistory;
+	 * GeneratedString and IterationHistory are left empty to avoid FString conversion.
+	 * @param Iterations Number of iterations to perform
+	 * @return FLSystemGenerationResult with native symbol buffers
+	 */
+	FLSystemGenerationResult GenerateSymbols(int32 Iterations);
+
+	/**
+	 * Native generation with the final iteration streamed instead of stored (C++ only).
+	 * The last rewrite is expanded block by block from the previous iteration's string and
+	 * handed to Sink, so the final (largest) string is never built. Peak memory is the
+	 * previous iteration plus one small block.
+	 * If generation stops early, the final string is passed to Sink in one call.
+	 * The streamed rewrite follows the sequential random order, so it matches GenerateSymbols
+	 * unless bParallelRewrite is enabled.
+	 * @param Iterations Number of iterations to perform
+	 * @param Sink Receives the final symbols in order
+	 * @return Result with empty Symbols; Stats describe the streamed string
+	 */
+	FLSystemGenerationResult GenerateStreamed(int32 Iterations, FLSystemSymbolSink Sink);
+
+	// ========================================================================
+	// Incremental Generation (growth animation)
+	// ========================================================================
+
+	/**
+	 * Advance the retained current string by one iteration.
+	 * Continues from the last Generate/GenerateSymbols/GrowOneIteration call (or starts from the
+	 * axiom), keeping the random stream, so for a seeded system Generate(N) followed by
+	 * GrowOneIteration produces the same string as Generate(N + 1) without redoing N iterations.
+	 * Statistics, timing and history accumulate over the steps; OnIterationComplete fires per step.
+	 * Rule changes take effect from the next step; Initialize, Reset and SetRandomSeed start over.
+	 * @return Result of the new iteration (failure once a termination limit is reached)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LSystem|Generation",
+		meta = (DisplayName = "Grow One Iteration", Keywords = "step next continue animate"))
+	FLSystemGenerationResult GrowOneIteration();
+
+	/**
+	 * Native form of GrowOneIteration (C++ only).
+	 * The result only carries Symbols/SymbolHistory, like GenerateSymbols.
+	 */
+	FLSystemGenerationResult GrowOneIterationSymbols();
+
+	/**
+	 * Check whether GrowOneIteration continues the current string.
+	 * False before the first generation, after a streamed or cancelled generation, and after
+	 * Initialize/Reset/SetRandomSeed; GrowOneIteration then starts again from the axiom.
+	 */
+	UFUNCTION(BlueprintPure, Category = "LSystem|Generation")
+	bool CanContinueGeneration() const { return bCanContinueGeneration; }
+
 	/**
 	 * Perform a single iteration on the given string.
 	 * Useful for step-by-step debugging.
@@ -308,21 +474,81 @@ protected:
 	// ========================================================================
 
 	/**
-	 * Apply all rules to transform the input string (one iteration).
-	 * @param InputString String to transform
-	 * @return Transformed string
+	 * Apply all rules to transform the input symbols (one iteration).
+	 * Dispatches to ApplyRulesParallel for large inputs when enabled in Config.
+	 * The output is sized once from PredictOutputLength. If even the shortest possible
+	 * output exceeds Config.MaxStringLength, nothing is rewritten.
+	 * @param Input Symbols to transform
+	 * @param Output Receives the transformed symbols (previous contents are discarded)
+	 * @return False if the iteration was skipped because it would exceed MaxStringLength
 	 */
-	FString ApplyRules(const FString& InputString);
+	bool ApplyRules(const FLSystemSymbolBuffer& Input, FLSystemSymbolBuffer& Output);
 
 	/**
-	 * Select a rule for the given symbol and context.
+	 * Predict the output length of rewriting [Start, End) from a symbol histogram.
+	 * Exact for deterministic rules, a tight [min, max] range for stochastic/context rules.
+	 * @param Input Symbols to be rewritten
+	 * @param Start First symbol of the range
+	 * @param End One past the last symbol of the range
+	 * @param OutMinLength Shortest possible output length
+	 * @param OutMaxLength Longest possible output length
+	 */
+	void PredictOutputLength(const FLSystemSymbolBuffer& Input, int32 Start, int32 End,
+	                         int64& OutMinLength, int64& OutMaxLength) const;
+
+	/**
+	 * Parallel form of ApplyRules.
+	 * The input is split into Config.ParallelChunkSize chunks that are rewritten with ParallelFor
+	 * (context is read across chunk borders), then concatenated in order using prefix-sum offsets.
+	 * Each chunk draws from its own stream, seeded from one value taken from RandomStream and the
+	 * chunk index, so seeded results do not depend on the number of worker threads.
+	 * @param Input Symbols to transform
+	 * @param Output Receives the transformed symbols (previous contents are discarded)
+	 * @return False if the iteration was skipped because it would exceed MaxStringLength
+	 */
+	bool ApplyRulesParallel(const FLSystemSymbolBuffer& Input, FLSystemSymbolBuffer& Output);
+
+	/**
+	 * Rewrite the input block by block and pass each block to Sink instead of building the output.
+	 * @param Input Symbols to transform
+	 * @param Sink Receives the rewritten symbols in order
+	 * @param OutCounts Histogram and bracket nesting the streamed symbols are added to
+	 * @param OutLength Number of symbols streamed
+	 * @return False if the iteration was skipped because it would exceed MaxStringLength (nothing streamed)
+	 */
+	bool StreamRules(const FLSystemSymbolBuffer& Input, FLSystemSymbolSink Sink,
+	                 FLSystemSymbolCounts& OutCounts, int32& OutLength);
+
+	/**
+	 * Rewrite the input range [Start, End) and append the result to Output.
+	 * Shared inner loop of the sequential and parallel paths. Does not touch shared state.
+	 * bCheckLength = false skips the per-symbol limit check when the predicted length fits.
+	 * @param Input Full input (context symbols are read outside the range)
+	 * @param Start First symbol to rewrite
+	 * @param End One past the last symbol to rewrite
+	 * @param Stream Random stream for stochastic rules
+	 * @param Output Buffer the rewritten symbols are appended to
+	 * @param MaxLength Stop once Output grows beyond this length
+	 * @param OutRulesApplied Incremented per applied rule
+	 * @param OutContextRulesApplied Incremented per applied context-sensitive rule
+	 * @return False if MaxLength was exceeded (Output is then longer than MaxLength)
+	 */
+	template <bool bCheckLength>
+	bool RewriteRange(const FLSystemSymbolBuffer& Input, int32 Start, int32 End, FRandomStream& Stream,
+	                  FLSystemSymbolBuffer& Output, int32 MaxLength,
+	                  int32& OutRulesApplied, int32& OutContextRulesApplied) const;
+
+	/**
+	 * Select a rule for the given symbol and context using the compiled rule table.
 	 * Handles context-sensitive matching and stochastic selection.
-	 * @param Symbol The symbol to find a rule for
-	 * @param LeftContext The character before the symbol (or '\0')
-	 * @param RightContext The character after the symbol (or '\0')
-	 * @return Pointer to selected rule, or nullptr if no rule matches
+	 * @param Entry The dispatch entry of the symbol being rewritten
+	 * @param LeftContext The symbol before the rewritten one (or 0)
+	 * @param RightContext The symbol after the rewritten one (or 0)
+	 * @param Stream Random stream used for stochastic selection
+	 * @return Pointer to the selected choice, or nullptr if no rule matches
 	 */
-	const FLSystemRule* SelectRule(TCHAR Symbol, TCHAR LeftContext, TCHAR RightContext);
+	const FLSystemRuleChoice* SelectRule(const FLSystemSymbolEntry& Entry, uint8 LeftContext, uint8 RightContext,
+	                                     FRandomStream& Stream) const;
 
 	/**
 	 * Build lookup tables for faster rule access.
@@ -330,6 +556,12 @@ protected:
 	 */
 	void BuildRuleLookup();
 
+	/**
+	 * Compile RuleLookup into the flat RuleTable.
+	 * Called at the end of BuildRuleLookup.
+	 */
+	void CompileRuleTable();
+
 	/**
 	 * Check if generation should terminate.
 	 * @param CurrentString Current string state
@@ -337,44 +569,47 @@ protected:
 	 * @param OutReason Reason for termination if returning true
 	 * @return True if generation should stop
 	 */
-	bool CheckTermination(const FString& CurrentString, int32 Iteration, FString& OutReason) const;
+	bool CheckTermination(const FLSystemSymbolBuffer& CurrentString, int32 Iteration, FString& OutReason) const;
 
 	/**
 	 * Update statistics after generation.
-	 * @param FinalString The final generated string
+	 * @param FinalLength Length of the final generated string
+	 * @param FinalCounts Symbol histogram and bracket nesting of the final string
 	 * @param Iterations Number of iterations completed
 	 * @param StartTime Time when generation started
 	 */
-	void UpdateStatistics(const FString& FinalString, int32 Iterations, double StartTime);
+	void UpdateStatistics(int32 FinalLength, const FLSystemSymbolCounts& FinalCounts, int32 Iterations, double StartTime);
 
 	/**
-	 * Calculate symbol counts for a string.
-	 * @param InputString String to analyze
+	 * Fill Statistics.SymbolCounts from a symbol histogram.
+	 * @param SymbolHistogram 256-entry symbol histogram
 	 */
-	void CalculateSymbolCounts(const FString& InputString);
+	void CalculateSymbolCounts(const int32* SymbolHistogram);
 
 	/**
 	 * Log iteration details (if detailed logging is enabled).
 	 * @param Iteration Current iteration number
 	 * @param CurrentString Current string state
 	 */
-	void LogIteration(int32 Iteration, const FString& CurrentString);
+	void LogIteration(int32 Iteration, const FLSystemSymbolBuffer& CurrentString);
 
 	/**
 	 * Perform the actual generation work.
 	 * Used by both sync and async paths.
 	 * @param Iterations Number of iterations
 	 * @param bAsync Whether this is an async call
+	 * @param FinalIterationSink If set, the final string is streamed here instead of stored in the result
 	 * @return Generation result
 	 */
-	FLSystemGenerationResult DoGeneration(int32 Iterations, bool bAsync = false);
+	FLSystemGenerationResult DoGeneration(int32 Iterations, bool bAsync = false,
+	                                      const FLSystemSymbolSink* FinalIterationSink = nullptr);
 
 	/**
 	 * Handle completion of async generation.
 	 * Called from the async task when done.
-	 * @param Result The generation result
+	 * @param Result The generation result (strings are materialized here before broadcasting)
 	 */
-	void HandleAsyncComplete(const FLSystemGenerationResult& Result);
+	void HandleAsyncComplete(FLSystemGenerationResult Result);
 
 private:
 	/** Current generation state */
@@ -392,21 +627,24 @@ private:
 	/** Cached total probabilities for each predecessor (for normalization) */
 	TMap<TCHAR, float> ProbabilityTotals;
 
+	/** Compiled, symbol-indexed dispatch table (built from RuleLookup) */
+	FLSystemRuleTable RuleTable;
+
+	/** Scratch output of GrowOneIteration (swapped with State.CurrentSymbols, so allocations are reused per step) */
+	FLSystemSymbolBuffer GrowthBuffer;
+
 	/** Flag indicating if lookup needs rebuilding */
 	bool bLookupDirty;
 
+	/** True while State.CurrentSymbols and RandomStream can be continued by GrowOneIteration */
+	bool bCanContinueGeneration;
+
 	/** Flag for cancelling async generation */
 	TAtomic<bool> bCancelRequested;
 
-	/** The async task (if running) */
-	FLSystemAsyncTask* CurrentAsyncTask;
-
-	/** Thread for async generation */
-	FRunnableThread* CurrentAsyncThread;
+	/** The async generation task on the task graph (invalid if never started) */
+	UE::Tasks::FTask CurrentAsyncTask;
 
 	/** Critical section for thread-safe state access */
 	mutable FCriticalSection StateLock;
-
-	// Friend class for async task access
-	friend class FLSystemAsyncTask;
 };
@@ -5,8 +5,287 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ProceduralMeshComponent.h"
 #include "LSystemTypes.generated.h"
 
+// ============================================================================
+// FLSystemSymbolBuffer - Compact Symbol Storage
+// ============================================================================
+
+/**
+ * Byte-per-symbol storage for L-System strings.
+ * Every symbol of the L-System alphabet is ASCII, so the generator and interpreter
+ * exchange raw bytes and only convert to FString at the Blueprint boundary.
+ * This halves memory and bandwidth compared to TCHAR strings.
+ */
+struct LSYSTEMTREES_API FLSystemSymbolBuffer
+{
+	/** Raw symbol bytes (no terminator) */
+	TArray<uint8> Data;
+
+	/** Default constructor */
+	FLSystemSymbolBuffer()
+	{
+	}
+
+	/** Construct from a string (non-ASCII symbols are dropped) */
+	explicit FLSystemSymbolBuffer(const FString& InString)
+	{
+		SetFromString(InString);
+	}
+
+	// ========== Validation ==========
+
+	/** Check if a character can be stored as a symbol */
+	static bool IsValidSymbol(TCHAR Symbol)
+	{
+		return Symbol > 0 && Symbol < 128;
+	}
+
+	/**
+	 * Find the first character that cannot be stored as a symbol.
+	 * @return Index of the invalid character, or INDEX_NONE if the whole string is valid
+	 */
+	static int32 FindInvalidSymbol(const FString& InString)
+	{
+		for (int32 i = 0; i < InString.Len(); ++i)
+		{
+			if (!IsValidSymbol(InString[i]))
+			{
+				return i;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// ========== Conversion ==========
+
+	/**
+	 * Replace contents with the given string.
+	 * @return False if the string contained non-ASCII symbols (they are dropped)
+	 */
+	bool SetFromString(const FString& InString)
+	{
+		const int32 Length = InString.Len();
+		const TCHAR* Chars = *InString;
+
+		Data.Reset(Length);
+		bool bAllValid = true;
+
+		for (int32 i = 0; i < Length; ++i)
+		{
+			if (IsValidSymbol(Chars[i]))
+			{
+				Data.Add(static_cast<uint8>(Chars[i]));
+			}
+			else
+			{
+				bAllValid = false;
+			}
+		}
+
+		return bAllValid;
+	}
+
+	/** Convert to FString (Blueprint boundary, logging) */
+	FString ToString() const
+	{
+		return ToString(0, Data.Num());
+	}
+
+	/** Convert a sub-range to FString */
+	FString ToString(int32 Start, int32 Count) const
+	{
+		return SymbolsToString(Data.GetData() + Start, Count);
+	}
+
+	/** Convert a raw run of symbols to FString */
+	static FString SymbolsToString(const uint8* Symbols, int32 Count)
+	{
+		FString Result;
+		if (Count <= 0)
+		{
+			return Result;
+		}
+
+		TArray<TCHAR>& Chars = Result.GetCharArray();
+		Chars.SetNumUninitialized(Count + 1);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Chars[i] = static_cast<TCHAR>(Symbols[i]);
+		}
+		Chars[Count] = TEXT('\0');
+
+		return Result;
+	}
+
+	// ========== Access ==========
+
+	int32 Num() const { return Data.Num(); }
+	bool IsEmpty() const { return Data.Num() == 0; }
+	const uint8* GetData() const { return Data.GetData(); }
+	uint8* GetData() { return Data.GetData(); }
+	uint8 operator[](int32 Index) const { return Data[Index]; }
+
+	/** Bytes allocated for symbol storage */
+	SIZE_T GetAllocatedSize() const { return Data.GetAllocatedSize(); }
+
+	/** Add the symbol counts of [Start, End) to a 256-entry histogram */
+	void AccumulateHistogram(int32* Histogram, int32 Start, int32 End) const
+	{
+		const uint8* Symbols = Data.GetData();
+		for (int32 i = Start; i < End; ++i)
+		{
+			Histogram[Symbols[i]]++;
+		}
+	}
+
+	// ========== Modification ==========
+
+	/** Empty the buffer, keeping (at least) the given capacity */
+	void Reset(int32 NewCapacity = 0) { Data.Reset(NewCapacity); }
+
+	/** Ensure capacity for the given number of symbols */
+	void Reserve(int32 Capacity) { Data.Reserve(Capacity); }
+
+	/** Append a single symbol */
+	void Add(uint8 Symbol) { Data.Add(Symbol); }
+
+	/** Append a run of symbols */
+	void Append(const uint8* Symbols, int32 Count) { Data.Append(Symbols, Count); }
+
+	/** Append another buffer */
+	void Append(const FLSystemSymbolBuffer& Other) { Data.Append(Other.Data); }
+
+	/** Keep only the first NewNum symbols */
+	void Truncate(int32 NewNum)
+	{
+		if (NewNum < Data.Num())
+		{
+			Data.SetNum(NewNum);
+		}
+	}
+
+	bool operator==(const FLSystemSymbolBuffer& Other) const { return Data == Other.Data; }
+	bool operator!=(const FLSystemSymbolBuffer& Other) const { return Data != Other.Data; }
+};
+
+/** Receives symbols streamed out of the generator, one block at a time */
+using FLSystemSymbolSink = TFunctionRef<void(const uint8* Symbols, int32 Count)>;
+
+/**
+ * Symbol histogram and bracket nesting of a symbol string, accumulated in a single pass.
+ * Symbols can be added block by block (nesting carries over between blocks).
+ */
+struct FLSystemSymbolCounts
+{
+	/** Count of each symbol */
+	int32 Histogram[256] = { 0 };
+
+	/** Bracket depth after the symbols added so far */
+	int32 BracketDepth = 0;
+
+	/** Deepest '[' nesting reached (unmatched ']' are ignored, as the turtle does) */
+	int32 MaxBracketDepth = 0;
+
+	/** Add a run of symbols */
+	void Accumulate(const uint8* Symbols, int32 Count)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const uint8 Symbol = Symbols[i];
+			Histogram[Symbol]++;
+
+			if (Symbol == '[')
+			{
+				MaxBracketDepth = FMath::Max(MaxBracketDepth, ++BracketDepth);
+			}
+			else if (Symbol == ']' && BracketDepth > 0)
+			{
+				--BracketDepth;
+			}
+		}
+	}
+
+	/** Add a whole buffer */
+	void Accumulate(const FLSystemSymbolBuffer& Symbols)
+	{
+		Accumulate(Symbols.GetData(), Symbols.Num());
+	}
+};
+
+// ============================================================================
+// FLSystemSymbolHistory - Per-Iteration Symbol Arena
+// ============================================================================
+
+/**
+ * Symbols of every stored iteration, packed back to back in a single arena.
+ * Iteration i occupies [Offsets[i], Offsets[i + 1]) so adding an iteration is one append
+ * and no per-iteration allocation. The generator shares one instance between its state
+ * and the generation result; it is only appended to while a generation is running.
+ */
+struct LSYSTEMTREES_API FLSystemSymbolHistory
+{
+	/** Symbols of all iterations, concatenated */
+	TArray<uint8> Arena;
+
+	/** Start offset of each iteration in Arena, plus a trailing end offset */
+	TArray<int32> Offsets;
+
+	/** Default constructor */
+	FLSystemSymbolHistory()
+	{
+		Offsets.Add(0);
+	}
+
+	/** Number of stored iterations */
+	int32 Num() const { return Offsets.Num() - 1; }
+
+	/** Length of the given iteration */
+	int32 GetLength(int32 Iteration) const { return Offsets[Iteration + 1] - Offsets[Iteration]; }
+
+	/** Symbols of the given iteration (GetLength() bytes, no terminator) */
+	const uint8* GetSymbols(int32 Iteration) const { return Arena.GetData() + Offsets[Iteration]; }
+
+	/** Append an iteration */
+	void Add(const FLSystemSymbolBuffer& Symbols)
+	{
+		Arena.Append(Symbols.GetData(), Symbols.Num());
+		Offsets.Add(Arena.Num());
+	}
+
+	/** Copy the given iteration into a standalone buffer */
+	FLSystemSymbolBuffer ToBuffer(int32 Iteration) const
+	{
+		FLSystemSymbolBuffer Out;
+		Out.Append(GetSymbols(Iteration), GetLength(Iteration));
+		return Out;
+	}
+
+	/** Convert the given iteration to FString (Blueprint boundary, logging) */
+	FString ToString(int32 Iteration) const
+	{
+		return FLSystemSymbolBuffer::SymbolsToString(GetSymbols(Iteration), GetLength(Iteration));
+	}
+
+	/** Convert every iteration to FString */
+	void ToStrings(TArray<FString>& OutStrings) const
+	{
+		OutStrings.Reset(Num());
+		for (int32 i = 0; i < Num(); ++i)
+		{
+			OutStrings.Add(ToString(i));
+		}
+	}
+
+	/** Bytes allocated for the arena and offsets */
+	SIZE_T GetAllocatedSize() const { return Arena.GetAllocatedSize() + Offsets.GetAllocatedSize(); }
+};
+
+/** History shared by reference between the generator state and generation results */
+using FLSystemSymbolHistoryPtr = TSharedPtr<FLSystemSymbolHistory, ESPMode::ThreadSafe>;
+
 // ============================================================================
 // FLSystemRule - Production Rule with Context-Sensitive Support
 // ============================================================================
@@ -287,7 +566,7 @@ struct LSYSTEMTREES_API FLSystemConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config")
 	int32 RandomSeed;
 
-	/** Whether to store iteration history (uses more memory but useful for debugging) */
+	/** Whether to store iteration history (off by default - uses more memory but useful for debugging) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config")
 	bool bStoreHistory;
 
@@ -295,13 +574,34 @@ struct LSYSTEMTREES_API FLSystemConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config")
 	bool bEnableDetailedLogging;
 
+	/**
+	 * Rewrite large strings in parallel chunks.
+	 * Seeded results are reproducible regardless of thread count, but differ from sequential rewriting
+	 * for stochastic rules (each chunk uses its own random stream).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config|Parallel")
+	bool bParallelRewrite;
+
+	/** Number of input symbols per parallel chunk (part of the seeded result - keep fixed for reproducibility) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config|Parallel",
+		meta = (ClampMin = "1024", UIMin = "4096", UIMax = "1048576", EditCondition = "bParallelRewrite"))
+	int32 ParallelChunkSize;
+
+	/** Minimum input length before an iteration is rewritten in parallel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LSystem|Config|Parallel",
+		meta = (ClampMin = "0", EditCondition = "bParallelRewrite"))
+	int32 ParallelMinLength;
+
 	/** Default constructor */
 	FLSystemConfig()
 		: MaxIterations(10)
 		, MaxStringLength(100000)
 		, RandomSeed(0)
-		, bStoreHistory(true)
+		, bStoreHistory(false)
 		, bEnableDetailedLogging(true)
+		, bParallelRewrite(false)
+		, ParallelChunkSize(65536)
+		, ParallelMinLength(262144)
 	{
 	}
 };
@@ -338,6 +638,10 @@ struct LSYSTEMTREES_API FLSystemStatistics
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LSystem|Statistics")
 	int32 ContextRulesApplied;
 
+	/** Deepest branch nesting ('[' depth) in the final string */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LSystem|Statistics")
+	int32 MaxBracketDepth;
+
 	/** Count of each symbol in the final string */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LSystem|Statistics")
 	TMap<FString, int32> SymbolCounts;
@@ -349,6 +653,7 @@ struct LSYSTEMTREES_API FLSystemStatistics
 		, GenerationTimeMs(0.0f)
 		, RulesApplied(0)
 		, ContextRulesApplied(0)
+		, MaxBracketDepth(0)
 	{
 	}
 
@@ -360,6 +665,7 @@ struct LSYSTEMTREES_API FLSystemStatistics
 		GenerationTimeMs = 0.0f;
 		RulesApplied = 0;
 		ContextRulesApplied = 0;
+		MaxBracketDepth = 0;
 		SymbolCounts.Empty();
 	}
 
@@ -367,8 +673,8 @@ struct LSYSTEMTREES_API FLSystemStatistics
 	FString ToString() const
 	{
 		return FString::Printf(
-			TEXT("Iterations: %d, Length: %d, Time: %.2fms, Rules: %d (Context: %d)"),
-			TotalIterations, FinalStringLength, GenerationTimeMs, RulesApplied, ContextRulesApplied
+			TEXT("Iterations: %d, Length: %d, Time: %.2fms, Rules: %d (Context: %d), Max Depth: %d"),
+			TotalIterations, FinalStringLength, GenerationTimeMs, RulesApplied, ContextRulesApplied, MaxBracketDepth
 		);
 	}
 };
@@ -405,6 +711,12 @@ struct LSYSTEMTREES_API FLSystemState
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LSystem|State")
 	float ProgressPercent;
 
+	/** Native symbol form of CurrentString (CurrentString is only filled when the state is read from Blueprint) */
+	FLSystemSymbolBuffer CurrentSymbols;
+
+	/** Native symbol form of History (null unless history is stored; shared with the generation result) */
+	FLSystemSymbolHistoryPtr SymbolHistory;
+
 	/** Default constructor */
 	FLSystemState()
 		: CurrentString(TEXT(""))
@@ -418,8 +730,10 @@ struct LSYSTEMTREES_API FLSystemState
 	void Reset()
 	{
 		CurrentString.Empty();
+		CurrentSymbols.Reset();
 		CurrentIteration = 0;
 		History.Empty();
+		SymbolHistory.Reset();
 		bIsGenerating = false;
 		ProgressPercent = 0.0f;
 	}
@@ -429,6 +743,7 @@ struct LSYSTEMTREES_API FLSystemState
 	{
 		Reset();
 		CurrentString = Axiom;
+		CurrentSymbols.SetFromString(Axiom);
 	}
 };
 
@@ -465,6 +780,15 @@ struct LSYSTEMTREES_API FLSystemGenerationResult
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LSystem|Result")
 	FLSystemStatistics Stats;
 
+	/**
+	 * The final generated symbols (native form used by the C++ pipeline).
+	 * GeneratedString is only filled by MaterializeStrings() at the Blueprint boundary.
+	 */
+	FLSystemSymbolBuffer Symbols;
+
+	/** Native symbol form of IterationHistory (null unless history is stored; shared, not copied) */
+	FLSystemSymbolHistoryPtr SymbolHistory;
+
 	/** Default constructor */
 	FLSystemGenerationResult()
 		: GeneratedString(TEXT(""))
@@ -473,16 +797,31 @@ struct LSYSTEMTREES_API FLSystemGenerationResult
 	{
 	}
 
+	/** Fill GeneratedString and IterationHistory from the native symbol buffers */
+	void MaterializeStrings()
+	{
+		GeneratedString = Symbols.ToString();
+
+		if (SymbolHistory.IsValid())
+		{
+			SymbolHistory->ToStrings(IterationHistory);
+		}
+		else
+		{
+			IterationHistory.Empty();
+		}
+	}
+
 	/** Create a success result */
-	static FLSystemGenerationResult Success(const FString& Result,
-	                                        const TArray<FString>& History,
+	static FLSystemGenerationResult Success(FLSystemSymbolBuffer&& Result,
+	                                        FLSystemSymbolHistoryPtr&& History,
 	                                        const FLSystemStatistics& Statistics)
 	{
 		FLSystemGenerationResult Out;
-		Out.GeneratedString = Result;
+		Out.Symbols = MoveTemp(Result);
 		Out.bSuccess = true;
 		Out.ErrorMessage.Empty();
-		Out.IterationHistory = History;
+		Out.SymbolHistory = MoveTemp(History);
 		Out.Stats = Statistics;
 		return Out;
 	}
@@ -719,6 +1058,189 @@ struct LSYSTEMTREES_API FLeafData
 	}
 };
 
+// ============================================================================
+// FTreeSkeleton - Struct-of-Arrays Turtle Output
+// ============================================================================
+
+/**
+ * Branch segments and leaves in struct-of-arrays form (C++ only).
+ * Written in place by UTurtleInterpreter and read directly by UTreeGeometry, so each meshing
+ * loop only streams the arrays it needs. Values are single precision (tree-local space).
+ * FBranchSegment/FLeafData remain the Blueprint-facing form, see ToArrays/FromArrays;
+ * MaterialIndex is not stored since the turtle always emits 0.
+ */
+struct LSYSTEMTREES_API FTreeSkeleton
+{
+	// ========== Segments ==========
+
+	TArray<FVector3f> SegmentStarts;
+	TArray<FVector3f> SegmentEnds;
+
+	/** Normalized segment directions */
+	TArray<FVector3f> SegmentDirections;
+
+	TArray<float> StartRadii;
+	TArray<float> EndRadii;
+
+	/** Index of the parent segment (-1 for roots) */
+	TArray<int32> ParentIndices;
+
+	/** Branching depth (0 = trunk) */
+	TArray<uint16> SegmentDepths;
+
+	// ========== Leaves ==========
+
+	TArray<FVector3f> LeafPositions;
+	TArray<FVector3f> LeafNormals;
+	TArray<FVector3f> LeafUps;
+	TArray<FVector2f> LeafSizes;
+
+	/** Rotation around the normal in degrees */
+	TArray<float> LeafRotations;
+
+	/** Branch depth where the leaf was placed */
+	TArray<uint16> LeafDepths;
+
+	// ========== Access ==========
+
+	int32 NumSegments() const { return SegmentStarts.Num(); }
+	int32 NumLeaves() const { return LeafPositions.Num(); }
+
+	float GetSegmentLength(int32 Index) const
+	{
+		return FVector3f::Dist(SegmentStarts[Index], SegmentEnds[Index]);
+	}
+
+	/** Bytes allocated by all arrays */
+	SIZE_T GetAllocatedSize() const
+	{
+		return SegmentStarts.GetAllocatedSize() + SegmentEnds.GetAllocatedSize() +
+		       SegmentDirections.GetAllocatedSize() + StartRadii.GetAllocatedSize() +
+		       EndRadii.GetAllocatedSize() + ParentIndices.GetAllocatedSize() +
+		       SegmentDepths.GetAllocatedSize() + LeafPositions.GetAllocatedSize() +
+		       LeafNormals.GetAllocatedSize() + LeafUps.GetAllocatedSize() +
+		       LeafSizes.GetAllocatedSize() + LeafRotations.GetAllocatedSize() +
+		       LeafDepths.GetAllocatedSize();
+	}
+
+	// ========== Modification ==========
+
+	/** Append a segment and return its index */
+	int32 AddSegment(const FVector& Start, const FVector& End, const FVector& Direction,
+	                 float StartRadius, float EndRadius, int32 Depth, int32 ParentIndex)
+	{
+		SegmentStarts.Add(FVector3f(Start));
+		SegmentEnds.Add(FVector3f(End));
+		SegmentDirections.Add(FVector3f(Direction));
+		StartRadii.Add(StartRadius);
+		EndRadii.Add(EndRadius);
+		ParentIndices.Add(ParentIndex);
+		SegmentDepths.Add(static_cast<uint16>(FMath::Clamp(Depth, 0, MAX_uint16)));
+		return SegmentStarts.Num() - 1;
+	}
+
+	/** Append a leaf and return its index */
+	int32 AddLeaf(const FVector& Position, const FVector& Normal, const FVector& Up,
+	              const FVector2D& Size, float Rotation, int32 Depth)
+	{
+		LeafPositions.Add(FVector3f(Position));
+		LeafNormals.Add(FVector3f(Normal));
+		LeafUps.Add(FVector3f(Up));
+		LeafSizes.Add(FVector2f(Size));
+		LeafRotations.Add(Rotation);
+		LeafDepths.Add(static_cast<uint16>(FMath::Clamp(Depth, 0, MAX_uint16)));
+		return LeafPositions.Num() - 1;
+	}
+
+	/** Ensure capacity for the given counts (call before interpretation to avoid regrowing) */
+	void Reserve(int32 InNumSegments, int32 InNumLeaves)
+	{
+		SegmentStarts.Reserve(InNumSegments);
+		SegmentEnds.Reserve(InNumSegments);
+		SegmentDirections.Reserve(InNumSegments);
+		StartRadii.Reserve(InNumSegments);
+		EndRadii.Reserve(InNumSegments);
+		ParentIndices.Reserve(InNumSegments);
+		SegmentDepths.Reserve(InNumSegments);
+
+		LeafPositions.Reserve(InNumLeaves);
+		LeafNormals.Reserve(InNumLeaves);
+		LeafUps.Reserve(InNumLeaves);
+		LeafSizes.Reserve(InNumLeaves);
+		LeafRotations.Reserve(InNumLeaves);
+		LeafDepths.Reserve(InNumLeaves);
+	}
+
+	/** Remove all segments and leaves, keeping the allocations */
+	void Reset()
+	{
+		SegmentStarts.Reset();
+		SegmentEnds.Reset();
+		SegmentDirections.Reset();
+		StartRadii.Reset();
+		EndRadii.Reset();
+		ParentIndices.Reset();
+		SegmentDepths.Reset();
+
+		LeafPositions.Reset();
+		LeafNormals.Reset();
+		LeafUps.Reset();
+		LeafSizes.Reset();
+		LeafRotations.Reset();
+		LeafDepths.Reset();
+	}
+
+	// ========== Conversion ==========
+
+	/** Convert to the Blueprint-facing structs */
+	void ToArrays(TArray<FBranchSegment>& OutSegments, TArray<FLeafData>& OutLeaves) const
+	{
+		OutSegments.SetNum(NumSegments());
+		for (int32 i = 0; i < NumSegments(); ++i)
+		{
+			FBranchSegment& Segment = OutSegments[i];
+			Segment.StartPosition = FVector(SegmentStarts[i]);
+			Segment.EndPosition = FVector(SegmentEnds[i]);
+			Segment.Direction = FVector(SegmentDirections[i]);
+			Segment.StartRadius = StartRadii[i];
+			Segment.EndRadius = EndRadii[i];
+			Segment.Depth = SegmentDepths[i];
+			Segment.MaterialIndex = 0;
+			Segment.ParentSegmentIndex = ParentIndices[i];
+		}
+
+		OutLeaves.SetNum(NumLeaves());
+		for (int32 i = 0; i < NumLeaves(); ++i)
+		{
+			FLeafData& Leaf = OutLeaves[i];
+			Leaf.Position = FVector(LeafPositions[i]);
+			Leaf.Normal = FVector(LeafNormals[i]);
+			Leaf.UpDirection = FVector(LeafUps[i]);
+			Leaf.Size = FVector2D(LeafSizes[i]);
+			Leaf.Rotation = LeafRotations[i];
+			Leaf.Depth = LeafDepths[i];
+		}
+	}
+
+	/** Replace contents with the given Blueprint-facing structs */
+	void FromArrays(const TArray<FBranchSegment>& Segments, const TArray<FLeafData>& Leaves)
+	{
+		Reset();
+		Reserve(Segments.Num(), Leaves.Num());
+
+		for (const FBranchSegment& Segment : Segments)
+		{
+			AddSegment(Segment.StartPosition, Segment.EndPosition, Segment.Direction,
+			           Segment.StartRadius, Segment.EndRadius, Segment.Depth, Segment.ParentSegmentIndex);
+		}
+
+		for (const FLeafData& Leaf : Leaves)
+		{
+			AddLeaf(Leaf.Position, Leaf.Normal, Leaf.UpDirection, Leaf.Size, Leaf.Rotation, Leaf.Depth);
+		}
+	}
+};
+
 // ============================================================================
 // FTurtleConfig - Turtle Interpretation Configuration
 // ============================================================================
@@ -889,11 +1411,36 @@ struct LSYSTEMTREES_API FTreeLODLevel
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
 	bool bIncludeLeaves;
 
+	// ========== Simplification ==========
+
+	/** Merge parent->child chains whose direction stays within this many degrees (0 = keep every segment) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification",
+		meta = (ClampMin = "0", ClampMax = "90", UIMin = "0", UIMax = "45"))
+	float MergeAngleThreshold;
+
+	/** Prune branches starting thinner than this radius, with everything above them (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification",
+		meta = (ClampMin = "0", UIMin = "0", UIMax = "5"))
+	float MinBranchRadius;
+
+	/** Prune twigs whose total length (segment plus everything above it) is below this (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification",
+		meta = (ClampMin = "0", UIMin = "0", UIMax = "200"))
+	float MinBranchLength;
+
+	/** Replace each pruned twig cluster with one leaf card covering it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification")
+	bool bReplacePrunedWithCards;
+
 	/** Default constructor */
 	FTreeLODLevel()
 		: RadialSegments(8)
 		, ScreenSize(0.5f)
 		, bIncludeLeaves(true)
+		, MergeAngleThreshold(0.0f)
+		, MinBranchRadius(0.0f)
+		, MinBranchLength(0.0f)
+		, bReplacePrunedWithCards(false)
 	{
 	}
 
@@ -902,20 +1449,31 @@ struct LSYSTEMTREES_API FTreeLODLevel
 		: RadialSegments(InSegments)
 		, ScreenSize(InScreenSize)
 		, bIncludeLeaves(InIncludeLeaves)
+		, MergeAngleThreshold(0.0f)
+		, MinBranchRadius(0.0f)
+		, MinBranchLength(0.0f)
+		, bReplacePrunedWithCards(false)
+	{
+	}
+
+	/** Whether any simplification is enabled */
+	bool HasSimplification() const
 	{
+		return MergeAngleThreshold > 0.0f || MinBranchRadius > 0.0f || MinBranchLength > 0.0f;
 	}
 };
 
 // ============================================================================
-// FTreeMeshData - Generated Mesh Data
+// FTreeMeshSectionData - Render-Ready Mesh Section
 // ============================================================================
 
 /**
- * Contains all mesh data generated for a tree at a single LOD level.
- * This data can be passed directly to UProceduralMeshComponent.
+ * Vertex and index streams of one mesh section, stored in the exact layout
+ * UProceduralMeshComponent::CreateMeshSection / UpdateMeshSection take.
+ * Triangle indices are local to the section.
  */
 USTRUCT(BlueprintType)
-struct LSYSTEMTREES_API FTreeMeshData
+struct LSYSTEMTREES_API FTreeMeshSectionData
 {
 	GENERATED_BODY()
 
@@ -923,7 +1481,7 @@ struct LSYSTEMTREES_API FTreeMeshData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
 	TArray<FVector> Vertices;
 
-	/** Triangle indices (3 per triangle) */
+	/** Triangle indices (3 per triangle, local to this section) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
 	TArray<int32> Triangles;
 
@@ -935,61 +1493,147 @@ struct LSYSTEMTREES_API FTreeMeshData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
 	TArray<FVector2D> UVs;
 
-	/** Vertex colors */
+	/** Vertex colors (sRGB) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
-	TArray<FLinearColor> VertexColors;
+	TArray<FColor> VertexColors;
 
 	/** Tangent vectors for normal mapping */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
-	TArray<FVector> Tangents;
+	TArray<FProcMeshTangent> Tangents;
 
-	/** Number of vertices in branch section (rest are leaves) */
+	/** Reset all section data */
+	void Reset()
+	{
+		Vertices.Empty();
+		Triangles.Empty();
+		Normals.Empty();
+		UVs.Empty();
+		VertexColors.Empty();
+		Tangents.Empty();
+	}
+
+	/** Reserve exact capacity for all streams */
+	void Reserve(int32 NumVertices, int32 NumIndices)
+	{
+		Vertices.Reserve(NumVertices);
+		Normals.Reserve(NumVertices);
+		UVs.Reserve(NumVertices);
+		VertexColors.Reserve(NumVertices);
+		Tangents.Reserve(NumVertices);
+		Triangles.Reserve(NumIndices);
+	}
+
+	/** Check if the section has any geometry */
+	bool IsValid() const
+	{
+		return Vertices.Num() > 0 && Triangles.Num() > 0;
+	}
+
+	/** Get vertex count */
+	int32 GetVertexCount() const
+	{
+		return Vertices.Num();
+	}
+
+	/** Get triangle count */
+	int32 GetTriangleCount() const
+	{
+		return Triangles.Num() / 3;
+	}
+
+	/** Bytes allocated for all streams */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Vertices.GetAllocatedSize() + Triangles.GetAllocatedSize() + Normals.GetAllocatedSize() +
+		       UVs.GetAllocatedSize() + VertexColors.GetAllocatedSize() + Tangents.GetAllocatedSize();
+	}
+};
+
+// ============================================================================
+// FTreeMeshData - Generated Mesh Data
+// ============================================================================
+
+/**
+ * Contains all mesh data generated for a tree at a single LOD level.
+ * Each section can be passed directly to UProceduralMeshComponent without conversion.
+ */
+USTRUCT(BlueprintType)
+struct LSYSTEMTREES_API FTreeMeshData
+{
+	GENERATED_BODY()
+
+	/** Mesh section index of the branch geometry */
+	static constexpr int32 BranchSectionIndex = 0;
+
+	/** Mesh section index of the leaf geometry */
+	static constexpr int32 LeafSectionIndex = 1;
+
+	/** Number of mesh sections */
+	static constexpr int32 NumSections = 2;
+
+	/** Branch geometry (mesh section 0) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
-	int32 BranchVertexCount;
+	FTreeMeshSectionData Branches;
 
-	/** Number of triangles in branch section */
+	/** Leaf geometry (mesh section 1) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
-	int32 BranchTriangleCount;
+	FTreeMeshSectionData Leaves;
 
-	/** Default constructor */
-	FTreeMeshData()
-		: BranchVertexCount(0)
-		, BranchTriangleCount(0)
+	/** Get a section by mesh section index */
+	const FTreeMeshSectionData& GetSection(int32 SectionIndex) const
 	{
+		return SectionIndex == LeafSectionIndex ? Leaves : Branches;
 	}
 
 	/** Reset all mesh data */
 	void Reset()
 	{
-		Vertices.Empty();
-		Triangles.Empty();
-		Normals.Empty();
-		UVs.Empty();
-		VertexColors.Empty();
-		Tangents.Empty();
-		BranchVertexCount = 0;
-		BranchTriangleCount = 0;
+		Branches.Reset();
+		Leaves.Reset();
 	}
 
 	/** Check if mesh data is valid */
 	bool IsValid() const
 	{
-		return Vertices.Num() > 0 && Triangles.Num() > 0;
+		return Branches.IsValid() || Leaves.IsValid();
 	}
 
 	/** Get total vertex count */
 	int32 GetVertexCount() const
 	{
-		return Vertices.Num();
+		return Branches.GetVertexCount() + Leaves.GetVertexCount();
 	}
 
 	/** Get total triangle count */
 	int32 GetTriangleCount() const
 	{
-		return Triangles.Num() / 3;
+		return Branches.GetTriangleCount() + Leaves.GetTriangleCount();
+	}
+
+	/** Bytes allocated for both sections */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Branches.GetAllocatedSize() + Leaves.GetAllocatedSize();
 	}
 };
 
+// ============================================================================
+// ETreeCollisionMode - Tree Collision Representation
+// ============================================================================
+
+/**
+ * How collision is built for a generated tree.
+ */
+UENUM(BlueprintType)
+enum class ETreeCollisionMode : uint8
+{
+	/** Simple capsules fitted to the thickest branch chains (cost scales with branch structure) */
+	Capsules UMETA(DisplayName = "Branch Capsules"),
+
+	/** Per-triangle collision from the highest detail LOD (expensive to build and query) */
+	Triangles UMETA(DisplayName = "Mesh Triangles")
+};
+
 // ============================================================================
 // FTreeGeometryConfig - Geometry Generation Configuration
 // ============================================================================
@@ -1015,21 +1659,50 @@ struct LSYSTEMTREES_API FTreeGeometryConfig
 		meta = (ClampMin = "0", ClampMax = "180"))
 	float LeafRandomRotation;
 
-	/** Whether to generate collision for LOD0 */
+	/** Whether to generate collision for the tree */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Collision")
 	bool bGenerateCollision;
 
+	/** Collision representation */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Collision",
+		meta = (EditCondition = "bGenerateCollision"))
+	ETreeCollisionMode CollisionMode;
+
+	/** Deepest branch level that gets capsules (0 = trunk only, 1 = trunk and first-order branches) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Collision",
+		meta = (ClampMin = "0", UIMax = "4", EditCondition = "bGenerateCollision && CollisionMode == ETreeCollisionMode::Capsules"))
+	int32 CollisionMaxDepth;
+
+	/** Segments thinner than this (average radius) get no capsule */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Collision",
+		meta = (ClampMin = "0", EditCondition = "bGenerateCollision && CollisionMode == ETreeCollisionMode::Capsules"))
+	float CollisionMinRadius;
+
+	/** Upper bound on the capsule count (the thickest are kept, 0 = unlimited) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Collision",
+		meta = (ClampMin = "0", EditCondition = "bGenerateCollision && CollisionMode == ETreeCollisionMode::Capsules"))
+	int32 MaxCollisionCapsules;
+
 	/** UV tiling for bark texture (along branch length) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|UVs",
 		meta = (ClampMin = "0.1", UIMin = "0.5", UIMax = "5"))
 	float BarkUVTiling;
 
+	/** Blend bark normals across branch junctions and lean them with the branch taper */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|Normals")
+	bool bSmoothNormals;
+
 	/** Default constructor with default LOD levels */
 	FTreeGeometryConfig()
 		: LeafSize(10.0f, 15.0f)
 		, LeafRandomRotation(30.0f)
 		, bGenerateCollision(true)
+		, CollisionMode(ETreeCollisionMode::Capsules)
+		, CollisionMaxDepth(1)
+		, CollisionMinRadius(2.0f)
+		, MaxCollisionCapsules(64)
 		, BarkUVTiling(1.0f)
+		, bSmoothNormals(true)
 	{
 		// Default 3 LOD levels
 		LODLevels.Add(FTreeLODLevel(16, 1.0f, true));   // LOD0: High detail
@@ -1038,6 +1711,133 @@ struct LSYSTEMTREES_API FTreeGeometryConfig
 	}
 };
 
+// ============================================================================
+// FTreeBakeSettings - Static Mesh Baking Configuration
+// ============================================================================
+
+/**
+ * Options for baking generated tree LODs into a UStaticMesh.
+ */
+USTRUCT(BlueprintType)
+struct LSYSTEMTREES_API FTreeBakeSettings
+{
+	GENERATED_BODY()
+
+	/** Enable Nanite on the baked mesh (editor builds only - cooked runtime bakes are never Nanite) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bake")
+	bool bEnableNanite;
+
+	/** Build collision for the baked mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bake")
+	bool bBuildCollision;
+
+	/** Keep a CPU copy of the vertex data (needed for CPU-side mesh queries at runtime) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bake")
+	bool bAllowCPUAccess;
+
+	/** Default constructor */
+	FTreeBakeSettings()
+		: bEnableNanite(false)
+		, bBuildCollision(true)
+		, bAllowCPUAccess(false)
+	{
+	}
+};
+
+// ============================================================================
+// FTreeGenerationBreakdown - Per-Stage Cost of the Last Generation
+// ============================================================================
+
+/**
+ * Where the time and memory of a component's last generation went.
+ * Stages reused from the previous generation (or skipped by a cache hit) report 0 ms.
+ */
+USTRUCT(BlueprintType)
+struct LSYSTEMTREES_API FTreeGenerationBreakdown
+{
+	GENERATED_BODY()
+
+	/** L-System rewriting time (includes the turtle when the final iteration was streamed) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	float LSystemTimeMs;
+
+	/** Turtle interpretation time */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	float TurtleTimeMs;
+
+	/** Mesh generation time for all LODs */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	float GeometryTimeMs;
+
+	/** Game thread time to upload the mesh, leaves and collision */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	float ApplyTimeMs;
+
+	/** Sum of all stage times */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	float TotalTimeMs;
+
+	/** True if the tree came from the generation cache instead of the pipeline */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	bool bFromCache;
+
+	/** Number of final L-System symbols (0 when the final iteration was streamed) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int32 SymbolCount;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int32 SegmentCount;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int32 LeafCount;
+
+	/** Triangles summed over all LODs */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int32 TriangleCount;
+
+	/** Bytes allocated by the symbol buffer */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int64 SymbolBytes;
+
+	/** Bytes allocated by the segment and leaf streams */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int64 SkeletonBytes;
+
+	/** Bytes allocated by the mesh data of all LODs */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Tree|Statistics")
+	int64 MeshBytes;
+
+	/** Default constructor */
+	FTreeGenerationBreakdown()
+		: LSystemTimeMs(0.0f)
+		, TurtleTimeMs(0.0f)
+		, GeometryTimeMs(0.0f)
+		, ApplyTimeMs(0.0f)
+		, TotalTimeMs(0.0f)
+		, bFromCache(false)
+		, SymbolCount(0)
+		, SegmentCount(0)
+		, LeafCount(0)
+		, TriangleCount(0)
+		, SymbolBytes(0)
+		, SkeletonBytes(0)
+		, MeshBytes(0)
+	{
+	}
+
+	/** Convert to human-readable string */
+	FString ToString() const
+	{
+		return FString::Printf(
+			TEXT("Total: %.2fms%s (LSystem: %.2fms, Turtle: %.2fms, Geometry: %.2fms, Apply: %.2fms), ")
+			TEXT("Symbols: %d, Segments: %d, Leaves: %d, Triangles: %d, Memory: %.1f KB (Symbols: %.1f, Skeleton: %.1f, Mesh: %.1f)"),
+			TotalTimeMs, bFromCache ? TEXT(" [cached]") : TEXT(""), LSystemTimeMs, TurtleTimeMs, GeometryTimeMs, ApplyTimeMs,
+			SymbolCount, SegmentCount, LeafCount, TriangleCount,
+			(SymbolBytes + SkeletonBytes + MeshBytes) / 1024.0, SymbolBytes / 1024.0, SkeletonBytes / 1024.0, MeshBytes / 1024.0
+		);
+	}
+};
+
 // ============================================================================
 // DELEGATES (must be declared AFTER structs they reference)
 // ============================================================================
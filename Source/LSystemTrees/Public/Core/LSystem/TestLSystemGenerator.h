@@ -183,4 +183,11 @@ private:
 
 	/** Reset test counters */
 	void ResetTestCounters();
+
+	/** Counts OnTreeGenerated broadcasts of the component under test */
+	UFUNCTION()
+	void HandleTreeGenerated(bool bSuccess);
+
+	/** OnTreeGenerated broadcasts seen by HandleTreeGenerated */
+	int32 TreeGeneratedCount;
 };
@@ -9,9 +9,89 @@
 #include "Core/LSystem/LSystemTypes.h"
 #include "TreeGeometry.generated.h"
 
+// Forward declarations
+struct FKSphylElem;
+
 // Log category
 DECLARE_LOG_CATEGORY_EXTERN(LogTreeGeometry, Log, All);
 
+// ============================================================================
+// FTreeMeshTopology - Shared Branch Connectivity
+// ============================================================================
+
+/** Ring layout and UV span of one branch segment */
+struct FTreeSegmentTopology
+{
+	/** Ordinal of the ring the segment starts at (INDEX_NONE for degenerate segments) */
+	int32 StartRing = INDEX_NONE;
+
+	/** Ordinal of the ring the segment ends at (INDEX_NONE for degenerate segments) */
+	int32 EndRing = INDEX_NONE;
+
+	/** True if the start ring is emitted by this segment (false when reusing the parent's end ring) */
+	bool bEmitsStartRing = false;
+
+	/** Bark V coordinate at the start and end rings */
+	float StartV = 0.0f;
+	float EndV = 0.0f;
+
+	bool IsValid() const { return EndRing != INDEX_NONE; }
+};
+
+/**
+ * Branch connectivity resolved once per tree and shared by every LOD build.
+ * Rings are numbered in emission order and every ring of a build has the same vertex count,
+ * so a ring's first vertex is simply RingOrdinal * RadialSegments at any detail level.
+ */
+struct LSYSTEMTREES_API FTreeMeshTopology
+{
+	/** One entry per input segment (dense, same indices as the segment array) */
+	TArray<FTreeSegmentTopology> Segments;
+
+	/** Total number of rings emitted */
+	int32 NumRings = 0;
+
+	/** Number of non-degenerate segments (each produces one ring-to-ring band) */
+	int32 NumValidSegments = 0;
+
+	/**
+	 * Resolve parent connectivity and UV spans in a single pass.
+	 * @param Skeleton Segments from turtle interpretation
+	 * @param BarkUVTiling UV tiling factor along branch length
+	 */
+	void Build(const FTreeSkeleton& Skeleton, float BarkUVTiling);
+
+	/** Clear all entries but keep the allocation */
+	void Reset()
+	{
+		Segments.Reset();
+		NumRings = 0;
+		NumValidSegments = 0;
+	}
+
+	SIZE_T GetAllocatedSize() const { return Segments.GetAllocatedSize(); }
+};
+
+// ============================================================================
+// FTreeMeshBuildContext - Per-Call Mesh Builder State
+// ============================================================================
+
+/**
+ * Working state of a single mesh build.
+ * Kept out of UTreeGeometry so several LODs can be built concurrently by one builder.
+ */
+struct FTreeMeshBuildContext
+{
+	/** Mesh data being built */
+	FTreeMeshData MeshData;
+
+	/** Accumulated V coordinate for UV mapping (unconnected cylinders only) */
+	float VCoordinate = 0.0f;
+
+	/** Radial segments used for every ring of this build */
+	int32 RadialSegments = 0;
+};
+
 /**
  * Generates mesh geometry from branch segments and leaf placements.
  *
@@ -23,7 +103,10 @@ DECLARE_LOG_CATEGORY_EXTERN(LogTreeGeometry, Log, All);
  *   - Quad generation for leaves
  *   - Multiple LOD level support
  *   - UV mapping for bark and leaf textures
- *   - Normal and tangent calculation
+ *   - Analytic UV-aligned tangents written during ring/quad emission
+ *   - Optional junction and taper normal smoothing (parallel post-pass)
+ *   - LODs built in parallel (all per-build state lives in FTreeMeshBuildContext)
+ *   - Reads the struct-of-arrays FTreeSkeleton (the Blueprint entry points convert to it)
  *
  * Example Usage:
  *   UTreeGeometry* Geometry = NewObject<UTreeGeometry>();
@@ -43,7 +126,8 @@ public:
 	// ========================================================================
 
 	/**
-	 * Generate mesh data for all LOD levels.
+	 * Generate mesh data for all LOD levels (each LOD is built on its own worker).
+	 * Safe to call from any thread as long as the configuration is not modified concurrently.
 	 * @param Segments Branch segments from turtle interpretation
 	 * @param Leaves Leaf placements from turtle interpretation
 	 * @param LODLevels Configuration for each LOD level
@@ -68,6 +152,89 @@ public:
 	                           int32 RadialSegments,
 	                           bool bIncludeLeaves);
 
+	/**
+	 * Generate mesh data for all LOD levels from a skeleton (C++ only, no conversion).
+	 * @param Skeleton Segments and leaves from UTurtleInterpreter::InterpretSymbolsToSkeleton
+	 * @param LODLevels Configuration for each LOD level
+	 * @return Array of mesh data, one per LOD level
+	 */
+	TArray<FTreeMeshData> GenerateMeshLODsFromSkeleton(const FTreeSkeleton& Skeleton,
+	                                                   const TArray<FTreeLODLevel>& LODLevels);
+
+	/**
+	 * Generate mesh data for a single detail level from a skeleton (C++ only, no conversion).
+	 * @param Skeleton Segments and leaves from turtle interpretation
+	 * @param RadialSegments Number of segments around each cylinder
+	 * @param bIncludeLeaves Whether to include leaf geometry
+	 * @return Generated mesh data
+	 */
+	FTreeMeshData GenerateMeshFromSkeleton(const FTreeSkeleton& Skeleton, int32 RadialSegments, bool bIncludeLeaves);
+
+	/**
+	 * Resolve branch connectivity for the given segments (shared by all LOD builds).
+	 * @param Segments Branch segments from turtle interpretation
+	 * @return Ring layout for every segment
+	 */
+	FTreeMeshTopology BuildTopology(const TArray<FBranchSegment>& Segments) const;
+
+	/** Resolve branch connectivity for a skeleton (shared by all LOD builds) */
+	FTreeMeshTopology BuildTopology(const FTreeSkeleton& Skeleton) const;
+
+	// ========================================================================
+	// Instanced Leaves
+	// ========================================================================
+
+	/**
+	 * Compute one instance transform per leaf, placed and oriented like the leaf quads.
+	 * The card mesh is expected centered on its origin and facing +Z, with the leaf's
+	 * height along X and its width along Y.
+	 * @param Skeleton Leaves from turtle interpretation
+	 * @param CardSize Size of the card mesh (X = height, Y = width), used to scale each leaf to its size
+	 * @param OutTransforms Receives the transforms in leaf order
+	 */
+	void BuildLeafInstanceTransforms(const FTreeSkeleton& Skeleton, const FVector2D& CardSize,
+	                                 TArray<FTransform>& OutTransforms) const;
+
+	// ========================================================================
+	// Collision
+	// ========================================================================
+
+	/**
+	 * Fit collision capsules to the thick part of the branch structure.
+	 * Nearly straight parent-to-child chains are merged into one capsule each, so the count
+	 * follows the number of branches rather than segments or triangles.
+	 * @param Skeleton Segments from turtle interpretation
+	 * @param MaxDepth Deepest branch level that gets capsules
+	 * @param MinRadius Segments with a smaller average radius are skipped
+	 * @param MaxCapsules Keep only the largest capsules beyond this count (0 = unlimited)
+	 * @param OutCapsules Receives capsules in component space (cylinder length spans the chain)
+	 */
+	static void BuildCollisionCapsules(const FTreeSkeleton& Skeleton, int32 MaxDepth, float MinRadius, int32 MaxCapsules,
+	                                   TArray<FKSphylElem>& OutCapsules);
+
+	// ========================================================================
+	// Compatibility
+	// ========================================================================
+
+	/**
+	 * Concatenate both sections into the single-buffer layout FTreeMeshData used before it was split
+	 * into Branches and Leaves (leaf indices offset past the branch vertices, branches first).
+	 * For Blueprints that read the old Vertices/Triangles/... fields, which UPROPERTY redirects cannot remap.
+	 * @param MeshData Mesh data to flatten
+	 * @param OutBranchVertexCount Number of leading vertices that belong to branches (rest are leaves)
+	 * @param OutBranchTriangleCount Number of leading triangles that belong to branches
+	 */
+	UFUNCTION(BlueprintPure, Category = "TreeGeometry|Compatibility")
+	static void FlattenMeshData(const FTreeMeshData& MeshData,
+	                            TArray<FVector>& OutVertices,
+	                            TArray<int32>& OutTriangles,
+	                            TArray<FVector>& OutNormals,
+	                            TArray<FVector2D>& OutUVs,
+	                            TArray<FLinearColor>& OutVertexColors,
+	                            TArray<FVector>& OutTangents,
+	                            int32& OutBranchVertexCount,
+	                            int32& OutBranchTriangleCount);
+
 	// ========================================================================
 	// Configuration
 	// ========================================================================
@@ -80,46 +247,72 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TreeGeometry|Leaves")
 	FVector2D DefaultLeafSize;
 
+	/** Blend bark normals across branch junctions and lean them with the branch taper */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TreeGeometry|Normals")
+	bool bSmoothNormals;
+
 protected:
+	// ========================================================================
+	// Mesh Building
+	// ========================================================================
+
+	/**
+	 * Build mesh data for a single detail level into the given context.
+	 * Reads only configuration from the builder, so concurrent calls with separate contexts are safe.
+	 */
+	void BuildMesh(FTreeMeshBuildContext& Context,
+	               const FTreeMeshTopology& Topology,
+	               const FTreeSkeleton& Skeleton,
+	               int32 RadialSegments,
+	               bool bIncludeLeaves) const;
+
 	// ========================================================================
 	// Branch Geometry
 	// ========================================================================
 
 	/**
 	 * Generate a tapered cylinder for a single branch segment.
+	 * @param Context Build context receiving the geometry
 	 * @param Segment The branch segment to generate geometry for
 	 * @param RadialSegments Number of segments around the cylinder
 	 */
-	void GenerateBranchCylinder(const FBranchSegment& Segment, int32 RadialSegments);
+	void GenerateBranchCylinder(FTreeMeshBuildContext& Context, const FBranchSegment& Segment, int32 RadialSegments) const;
 
 	/**
 	 * Generate a tapered cylinder with connectivity to parent segment.
 	 * Reuses parent's end ring when connected for smooth joints.
-	 * @param Segment The branch segment to generate geometry for
-	 * @param SegmentIndex Index of this segment in the array
+	 * @param Context Build context receiving the geometry
+	 * @param Skeleton Skeleton holding the segment
+	 * @param SegmentIndex The branch segment to generate geometry for
+	 * @param SegmentTopology Precomputed ring layout of this segment
 	 * @param RadialSegments Number of segments around the cylinder
 	 */
-	void GenerateBranchCylinderConnected(const FBranchSegment& Segment, int32 SegmentIndex, int32 RadialSegments);
+	void GenerateBranchCylinderConnected(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton, int32 SegmentIndex,
+	                                     const FTreeSegmentTopology& SegmentTopology, int32 RadialSegments) const;
 
 	/**
-	 * Generate a ring of vertices around a point.
+	 * Generate a ring of vertices around a point from the cached unit-circle template.
+	 * Tangents follow increasing U around the ring and come straight from the ring basis.
+	 * @param Context Build context receiving the vertices
 	 * @param Center Center point of the ring
-	 * @param Direction Direction the ring faces (cylinder axis)
+	 * @param Right First basis vector of the ring plane (unit, perpendicular to the cylinder axis)
+	 * @param Up Second basis vector of the ring plane (unit, perpendicular to Right and the axis)
 	 * @param Radius Radius of the ring
 	 * @param NumSegments Number of vertices in the ring
 	 * @param V UV V coordinate for this ring
 	 * @return Index of the first vertex in the ring
 	 */
-	int32 GenerateRing(const FVector& Center, const FVector& Direction, float Radius,
-	                   int32 NumSegments, float V);
+	int32 GenerateRing(FTreeMeshBuildContext& Context, const FVector& Center, const FVector& Right,
+	                   const FVector& Up, float Radius, int32 NumSegments, float V) const;
 
 	/**
 	 * Connect two rings with triangles.
+	 * @param Context Build context receiving the triangles
 	 * @param StartRingIndex First vertex index of the first ring
 	 * @param EndRingIndex First vertex index of the second ring
 	 * @param NumSegments Number of segments in each ring
 	 */
-	void ConnectRings(int32 StartRingIndex, int32 EndRingIndex, int32 NumSegments);
+	void ConnectRings(FTreeMeshBuildContext& Context, int32 StartRingIndex, int32 EndRingIndex, int32 NumSegments) const;
 
 	// ========================================================================
 	// Leaf Geometry
@@ -127,39 +320,32 @@ protected:
 
 	/**
 	 * Generate a quad for a single leaf.
-	 * @param Leaf The leaf placement data
+	 * @param Context Build context receiving the geometry
+	 * @param Skeleton Skeleton holding the leaf
+	 * @param LeafIndex The leaf to generate geometry for
 	 */
-	void GenerateLeafQuad(const FLeafData& Leaf);
+	void GenerateLeafQuad(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton, int32 LeafIndex) const;
+
+	/** Right and up vectors of a leaf's plane, rotated around its normal */
+	static void GetLeafBasis(const FVector& Normal, const FVector& UpDirection, float Rotation,
+	                         FVector& OutRight, FVector& OutUp);
 
 	// ========================================================================
 	// Utility Methods
 	// ========================================================================
 
-	/** Reset mesh data for a new generation pass */
-	void ResetMeshData();
-
 	/** Calculate perpendicular vectors for a direction */
-	void GetPerpendicularVectors(const FVector& Direction, FVector& OutRight, FVector& OutUp);
-
-	/** Calculate smooth normals for the mesh */
-	void CalculateSmoothNormals();
-
-	/** Calculate tangent vectors for normal mapping */
-	void CalculateTangents();
-
-private:
-	/** Current mesh data being built */
-	FTreeMeshData CurrentMeshData;
+	static void GetPerpendicularVectors(const FVector& Direction, FVector& OutRight, FVector& OutUp);
 
-	/** Current accumulated V coordinate for UV mapping */
-	float CurrentVCoordinate;
-
-	/** Random stream for leaf rotation variation */
-	FRandomStream RandomStream;
-
-	/** Maps segment index to its end ring's first vertex index */
-	TMap<int32, int32> SegmentEndRingIndices;
-
-	/** Current radial segments count (cached for connected segments) */
-	int32 CurrentRadialSegments;
+	/**
+	 * Smooth bark normals in place after the branch rings have been emitted.
+	 * Each ring's normals are made perpendicular to the radius-weighted average axis of every band
+	 * touching it (so shared junction rings blend parent and children) and leaned by the bands' taper.
+	 * Runs in parallel over contiguous ring ranges; tangents are re-orthogonalized, keeping their U alignment.
+	 * @param Context Build context holding the branch section
+	 * @param Skeleton Segments the rings were built from
+	 * @param Topology Connectivity the rings were built with
+	 */
+	void CalculateSmoothNormals(FTreeMeshBuildContext& Context, const FTreeSkeleton& Skeleton,
+	                            const FTreeMeshTopology& Topology) const;
 };
@@ -0,0 +1,56 @@
+// TreeMeshBaker.h
+// Bakes generated tree mesh LODs into UStaticMesh assets
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Core/LSystem/LSystemTypes.h"
+#include "TreeMeshBaker.generated.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+struct FMeshDescription;
+
+/**
+ * Converts FTreeMeshData LODs into a UStaticMesh so trees can be instanced (ISM/HISM) and,
+ * in editor builds, rendered with Nanite.
+ *
+ * Every tree LOD becomes one static mesh LOD with two material slots (bark, leaves).
+ * Editor builds go through source models (saveable, Nanite capable); cooked builds use
+ * UStaticMesh::BuildFromMeshDescriptions which works at runtime.
+ */
+UCLASS()
+class LSYSTEMTREES_API UTreeMeshBaker : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Material slot names of the baked mesh */
+	static const FName BarkSlotName;
+	static const FName LeafSlotName;
+
+	/**
+	 * Bake tree LODs into a new static mesh.
+	 * @param Outer Outer of the new mesh (transient package if null)
+	 * @param LODs Generated mesh data, LOD 0 first
+	 * @param LODLevels LOD settings the meshes were built with (provides screen sizes)
+	 * @param BarkMaterial Material for the bark slot (may be null)
+	 * @param LeafMaterial Material for the leaf slot (may be null)
+	 * @param Settings Bake options
+	 * @param MeshName Name of the new mesh object (unique name if None)
+	 * @return The baked mesh, or null if there was nothing to bake
+	 */
+	static UStaticMesh* BakeStaticMesh(UObject* Outer, const TArray<FTreeMeshData>& LODs,
+	                                   const TArray<FTreeLODLevel>& LODLevels,
+	                                   UMaterialInterface* BarkMaterial, UMaterialInterface* LeafMaterial,
+	                                   const FTreeBakeSettings& Settings, FName MeshName = NAME_None);
+
+	/**
+	 * Fill a mesh description from one tree LOD (one polygon group per section, created even when
+	 * the section is empty so group i always maps to material slot i across LODs).
+	 * Vertices are copied one-to-one so the baked mesh matches the procedural one exactly.
+	 */
+	static void BuildMeshDescription(const FTreeMeshData& MeshData, FMeshDescription& OutMeshDescription);
+};
@@ -0,0 +1,32 @@
+// TreeSimplifier.h
+// Topology-aware skeleton simplification for lower LODs
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/LSystem/LSystemTypes.h"
+
+/**
+ * Reduces a turtle skeleton for a lower detail level, between UTurtleInterpreter and UTreeGeometry.
+ *
+ * Driven by the simplification settings of FTreeLODLevel:
+ *   - Pruning: a branch starting thinner than MinBranchRadius, or a twig whose total length is
+ *     below MinBranchLength, is removed together with everything growing from it
+ *   - Cards: with bReplacePrunedWithCards every pruned cluster becomes one leaf card spanning it
+ *   - Merging: connected chains without side branches whose direction stays within
+ *     MergeAngleThreshold of the chain's first segment become a single segment
+ *
+ * Parents keep preceding their children, so the result feeds straight into the mesh builders.
+ */
+class LSYSTEMTREES_API FTreeSimplifier
+{
+public:
+	/**
+	 * Simplify a skeleton for one LOD level.
+	 * @param Skeleton Full-detail skeleton
+	 * @param LOD Level providing the simplification settings
+	 * @param OutSkeleton Receives the simplified skeleton (original leaves only if LOD.bIncludeLeaves, followed by the cards)
+	 */
+	static void Simplify(const FTreeSkeleton& Skeleton, const FTreeLODLevel& LOD, FTreeSkeleton& OutSkeleton);
+};
@@ -15,6 +15,26 @@ class UTreeMath;
 // Log category
 DECLARE_LOG_CATEGORY_EXTERN(LogTurtle, Log, All);
 
+/** Turtle command a symbol maps to (resolved through a 256-entry table instead of a per-symbol switch on TCHAR) */
+enum class ETurtleCommand : uint8
+{
+	None,
+	Forward,
+	Move,
+	YawLeft,
+	YawRight,
+	TurnAround,
+	PitchUp,
+	PitchDown,
+	RollRight,
+	RollLeft,
+	Push,
+	Pop,
+	Leaf,
+
+	Count
+};
+
 /**
  * Interprets L-System strings as 3D turtle graphics commands.
  *
@@ -70,6 +90,105 @@ public:
 	                     TArray<FBranchSegment>& OutSegments,
 	                     TArray<FLeafData>& OutLeaves);
 
+	/**
+	 * Interpret native L-System symbols (C++ only, no FString conversion).
+	 * @param Symbols The symbols to interpret (e.g. FLSystemGenerationResult::Symbols)
+	 * @param Config Configuration for interpretation (angles, step length, etc.)
+	 * @param OutSegments Output array of branch segments
+	 * @param OutLeaves Output array of leaf placements
+	 */
+	void InterpretSymbols(const FLSystemSymbolBuffer& Symbols,
+	                      const FTurtleConfig& Config,
+	                      TArray<FBranchSegment>& OutSegments,
+	                      TArray<FLeafData>& OutLeaves);
+
+	/**
+	 * Interpret native L-System symbols straight into a struct-of-arrays skeleton (C++ only).
+	 * Nothing is buffered or copied: segments and leaves are appended to OutSkeleton as they are
+	 * emitted. The skeleton is reserved from the symbol counts, reusing its existing allocations.
+	 * @param Symbols The symbols to interpret
+	 * @param Config Configuration for interpretation
+	 * @param OutSkeleton Receives the segments and leaves (previous contents are discarded)
+	 */
+	void InterpretSymbolsToSkeleton(const FLSystemSymbolBuffer& Symbols,
+	                                const FTurtleConfig& Config,
+	                                FTreeSkeleton& OutSkeleton);
+
+	// ========================================================================
+	// Streaming Interpretation (C++ only)
+	// ========================================================================
+
+	/**
+	 * Start incremental interpretation.
+	 * Feed symbols with ProcessSymbols (e.g. from ULSystemGenerator::GenerateStreamed), then call EndStream.
+	 * @param Config Configuration for interpretation
+	 */
+	void BeginStream(const FTurtleConfig& Config);
+
+	/**
+	 * Start incremental interpretation into a struct-of-arrays skeleton.
+	 * ProcessSymbols appends to OutSkeleton directly; finish with EndStream().
+	 * OutSkeleton must outlive the stream. Reserve it beforehand when the size is known.
+	 * @param Config Configuration for interpretation
+	 * @param OutSkeleton Receives the segments and leaves (previous contents are discarded)
+	 */
+	void BeginStream(const FTurtleConfig& Config, FTreeSkeleton& OutSkeleton);
+
+	/**
+	 * Preallocate the branch stack so pushes never allocate (call after BeginStream).
+	 * InterpretSymbols* do this themselves; streaming callers can pass
+	 * FLSystemStatistics::MaxBracketDepth of a previous generation with the same rules.
+	 * @param MaxBracketDepth Deepest '[' nesting expected
+	 */
+	void ReserveStateStack(int32 MaxBracketDepth);
+
+	/**
+	 * Interpret the next block of symbols. Turtle state carries over between blocks.
+	 * @param Symbols Pointer to the symbols
+	 * @param Count Number of symbols
+	 */
+	void ProcessSymbols(const uint8* Symbols, int32 Count);
+
+	/**
+	 * Finish incremental interpretation and retrieve the results.
+	 * @param OutSegments Output array of branch segments
+	 * @param OutLeaves Output array of leaf placements
+	 */
+	void EndStream(TArray<FBranchSegment>& OutSegments, TArray<FLeafData>& OutLeaves);
+
+	/** Finish incremental interpretation started with a skeleton (the results are already in it) */
+	void EndStream();
+
+	// ========================================================================
+	// Incremental Interpretation (C++ only)
+	// ========================================================================
+
+	/** Number of symbols between turtle checkpoints in incremental mode */
+	static constexpr int32 CheckpointInterval = 1024;
+
+	/**
+	 * Interpret symbols, reusing the output of the previous incremental call.
+	 * The turtle state is checkpointed about every CheckpointInterval symbols, never inside a run of
+	 * rotations (runs are summed into one rotation, so splitting one would round differently). If the
+	 * new symbols share a prefix with the previous ones and the config is unchanged, interpretation
+	 * resumes from the last checkpoint inside that prefix: segments and leaves produced before it are
+	 * kept and only the remainder is rebuilt. With a fixed Config.RandomSeed the output is identical
+	 * to InterpretSymbols.
+	 * Any other interpretation on this object discards the retained state.
+	 * @param Symbols The symbols to interpret
+	 * @param Config Configuration for interpretation
+	 * @param OutSegments Output array of branch segments
+	 * @param OutLeaves Output array of leaf placements
+	 * @return Index of the first segment that may differ from the previous call's output
+	 */
+	int32 InterpretSymbolsIncremental(const FLSystemSymbolBuffer& Symbols,
+	                                  const FTurtleConfig& Config,
+	                                  TArray<FBranchSegment>& OutSegments,
+	                                  TArray<FLeafData>& OutLeaves);
+
+	/** Drop the retained symbols and checkpoints (the next incremental call interprets everything) */
+	void ResetIncremental();
+
 	/**
 	 * Interpret string and return only segments (convenience function).
 	 * @param LSystemString The L-System string to interpret
@@ -160,8 +279,36 @@ protected:
 	/** Rotate a vector around an axis */
 	FVector RotateVector(const FVector& Vector, const FVector& Axis, float AngleDegrees);
 
-	/** Process a single character */
-	void ProcessSymbol(TCHAR Symbol);
+	/** Execute a non-rotation command (rotations go through HandleRotationRun) */
+	void ExecuteCommand(ETurtleCommand Command);
+
+	/**
+	 * Interpret the run of rotations about one axis starting at Symbols[Start] as a single rotation.
+	 * Rotating about an axis leaves that axis unchanged, so the run's angles (including their
+	 * random variations, drawn in symbol order) simply add up.
+	 * @return Index of the first symbol after the run
+	 */
+	int32 HandleRotationRun(const uint8* Symbols, int32 Start, int32 End);
+
+	/** Rotate Forward/Left around Up, Forward/Up around Left, or Left/Up around Forward */
+	void ApplyYaw(double Cos, double Sin);
+	void ApplyPitch(double Cos, double Sin);
+	void ApplyRoll(double Cos, double Sin);
+
+	/** Count a basis rotation and re-orthogonalize every ReorthogonalizeInterval rotations */
+	void OnBasisRotated();
+
+	/** Precompute the angle, cosine and sine of every rotation command from ActiveConfig */
+	void PrecomputeRotations();
+
+	/**
+	 * Interpret Symbols[Start, End). A rotation run that starts before End may continue up to RunLimit.
+	 * @return Index of the first symbol not interpreted (End, or later if a run crossed it)
+	 */
+	int32 ProcessSymbolRange(const uint8* Symbols, int32 Start, int32 End, int32 RunLimit);
+
+	/** Process Symbols[Start, End), saving a checkpoint at the first run boundary after every CheckpointInterval */
+	void ProcessSymbolsWithCheckpoints(const uint8* Symbols, int32 Start, int32 End);
 
 	/** Get random angle variation based on config (for yaw) */
 	float GetRandomAngleVariation();
@@ -180,8 +327,26 @@ private:
 	/** Current turtle state */
 	FTurtleState CurrentState;
 
+	/**
+	 * State saved by '[': only what a branch can change and ']' has to restore.
+	 * Up is rebuilt from Forward x Left and Depth is decremented on pop.
+	 */
+	struct FTurtleStackEntry
+	{
+		FVector Position;
+		FVector Forward;
+		FVector Left;
+		float CurrentWidth;
+		int32 LastSegmentIndex;
+	};
+
+	/** Branch nesting kept inline before the stack allocates (shallow trees never do) */
+	static constexpr int32 InlineStackDepth = 32;
+
+	using FTurtleStack = TArray<FTurtleStackEntry, TInlineAllocator<InlineStackDepth>>;
+
 	/** Stack of saved states for branching */
-	TArray<FTurtleState> StateStack;
+	FTurtleStack StateStack;
 
 	/** Active configuration */
 	FTurtleConfig ActiveConfig;
@@ -192,14 +357,68 @@ private:
 	/** Depth counter for skipping branches due to probability */
 	int32 SkipBranchDepth;
 
+	/** Skeleton receiving the output while streaming into one (null = OutputSegments/OutputLeaves) */
+	FTreeSkeleton* SkeletonOutput;
+
+	// ========================================================================
+	// Precomputed Rotations
+	// ========================================================================
+
+	/** Basis rotations between re-orthogonalizations (each one is exact up to rounding) */
+	static constexpr int32 ReorthogonalizeInterval = 16;
+
+	/** Fixed angle of a rotation command with its cosine and sine */
+	struct FTurtleRotation
+	{
+		float Angle = 0.0f;
+		double Cos = 1.0;
+		double Sin = 0.0;
+	};
+
+	/** Rotation of each rotation command at its configured angle (without variation) */
+	FTurtleRotation CommandRotations[static_cast<int32>(ETurtleCommand::Count)];
+
+	/** Rotations applied since the last re-orthogonalization */
+	int32 RotationsSinceReorthogonalize;
+
+	// ========================================================================
+	// Incremental State
+	// ========================================================================
+
+	/** Everything needed to resume interpretation before a given symbol */
+	struct FTurtleCheckpoint
+	{
+		int32 SymbolIndex;
+		FTurtleState State;
+		FTurtleStack Stack;
+		FRandomStream Stream;
+		int32 SkipBranchDepth;
+		int32 RotationsSinceReorthogonalize;
+		int32 MaxDepthReached;
+		int32 NumSegments;
+		int32 NumLeaves;
+	};
+
+	/** Checkpoints of the last incremental call, in symbol order */
+	TArray<FTurtleCheckpoint> Checkpoints;
+
+	/** Symbols of the last incremental call */
+	FLSystemSymbolBuffer IncrementalSymbols;
+
+	/** Config of the last incremental call */
+	FTurtleConfig IncrementalConfig;
+
+	/** True while the output arrays still hold the last incremental call's result */
+	bool bIncrementalValid;
+
 	// ========================================================================
 	// Output
 	// ========================================================================
 
-	/** Generated branch segments */
+	/** Generated branch segments (AoS interpretation only) */
 	TArray<FBranchSegment> OutputSegments;
 
-	/** Generated leaf placements */
+	/** Generated leaf placements (AoS interpretation only) */
 	TArray<FLeafData> OutputLeaves;
 
 	// ========================================================================
@@ -16,7 +16,12 @@
  * strings for debugging and development purposes.
  *
  * All drawing functions use Unreal's debug draw system which renders in the
- * game viewport when debugging is enabled.
+ * game viewport when debugging is enabled. Lines are collected and submitted to
+ * the world's line batcher in a single call, and large trees are decimated to
+ * stay within LSystemTrees.DebugDraw.MaxLines: elements smaller than
+ * LSystemTrees.DebugDraw.MinScreenSize (from the views rendered last frame) are
+ * skipped, then branches are dropped from the tips inward and the remaining
+ * elements are strided.
  *
  * Example Usage:
  *   UTreeDebugDraw::DrawBranchSegments(GetWorld(), Segments, 10.0f);
@@ -73,6 +78,23 @@ public:
 	                       const TArray<FLeafData>& Leaves,
 	                       float Duration = 5.0f);
 
+	/**
+	 * Draw a skeleton's branches and leaves straight from its arrays (no FBranchSegment conversion).
+	 * Branches colored by depth; both share one line budget, branches first.
+	 * @param WorldContext World context for drawing
+	 * @param Skeleton Skeleton to visualize
+	 * @param Transform Transform to apply to positions (component to world)
+	 * @param Duration How long the debug lines persist (0 = one frame)
+	 * @param bShowRadius Whether to show radius circles at joints
+	 * @param bShowLeaves Whether to draw leaves
+	 */
+	static void DrawSkeleton(const UObject* WorldContext,
+	                         const FTreeSkeleton& Skeleton,
+	                         const FTransform& Transform,
+	                         float Duration = 5.0f,
+	                         bool bShowRadius = false,
+	                         bool bShowLeaves = true);
+
 	// ========================================================================
 	// L-System String Visualization
 	// ========================================================================
@@ -155,4 +177,18 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "TreeDebug|Utility")
 	static FLinearColor GetSymbolColor(const FString& Symbol);
+
+	/** Maximum number of lines one draw call submits (LSystemTrees.DebugDraw.MaxLines, 0 = unlimited) */
+	static int32 GetMaxDebugLines();
+
+	/**
+	 * Decide how many branch depths fit in a line budget, shallowest first.
+	 * @param SegmentsPerDepth Number of segments at each depth (index = depth)
+	 * @param LinesPerSegment Lines submitted per segment
+	 * @param MaxLines Line budget (<= 0 = unlimited)
+	 * @param OutStride Stride for the first depth that does not fit (draw every Nth of its segments, 0 = none)
+	 * @return Number of depths drawn in full; depths beyond the strided one are dropped
+	 */
+	static int32 GetDecimationDepth(const TArray<int32>& SegmentsPerDepth, int32 LinesPerSegment,
+	                                int32 MaxLines, int32& OutStride);
 };
@@ -0,0 +1,130 @@
+// TreeBenchmark.h
+// Repeatable per-stage benchmarks of the generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/LSystem/LSystemTypes.h"
+
+class FJsonObject;
+
+// ============================================================================
+// FTreeBenchmarkPreset - Benchmark Input
+// ============================================================================
+
+/** One tree description to benchmark (the presets of TREE_PRESETS.md are built in) */
+struct LSYSTEMTREES_API FTreeBenchmarkPreset
+{
+	FString Name;
+	FString Axiom;
+	TArray<FLSystemRule> Rules;
+
+	/** Iteration count the preset is designed for */
+	int32 Iterations = 0;
+
+	FTurtleConfig TurtleConfig;
+	FTreeGeometryConfig GeometryConfig;
+};
+
+// ============================================================================
+// FTreeBenchmarkResult - Per-Stage Measurements
+// ============================================================================
+
+/** Timings and sizes of one (preset, iterations, seed) case; times are the best of all repeats */
+struct LSYSTEMTREES_API FTreeBenchmarkResult
+{
+	FString Preset;
+	int32 Iterations = 0;
+	int32 Seed = 0;
+
+	// ========== Timings (ms) ==========
+
+	/** L-System rewriting (ULSystemGenerator::GenerateSymbols) */
+	double GenerateMs = 0.0;
+
+	/** Turtle interpretation into the skeleton */
+	double InterpretMs = 0.0;
+
+	/** Each LOD built on its own (topology, simplification and meshing) */
+	TArray<double> LODMs;
+
+	/** All LODs built together as the component does (parallel, wall clock) */
+	double AllLODsMs = 0.0;
+
+	/** Copying every LOD into procedural mesh sections (CPU side of the upload) */
+	double UploadMs = 0.0;
+
+	// ========== Sizes ==========
+
+	int32 Symbols = 0;
+	int32 Segments = 0;
+	int32 Leaves = 0;
+
+	/** Triangles per LOD */
+	TArray<int32> LODTriangles;
+
+	/** Bytes held by symbols, skeleton and meshes */
+	uint64 OutputBytes = 0;
+
+	/** Process peak physical memory after the case (monotonic across a run) */
+	uint64 PeakUsedPhysical = 0;
+
+	// ========== Derived ==========
+
+	/** Unique case name: Preset/Iterations/Seed */
+	FString GetKey() const;
+
+	double GetTotalMs() const { return GenerateMs + InterpretMs + AllLODsMs + UploadMs; }
+	double GetSymbolsPerSecond() const;
+	double GetSegmentsPerSecond() const;
+	double GetTrianglesPerSecond() const;
+};
+
+// ============================================================================
+// FTreeBenchmark - Harness
+// ============================================================================
+
+/**
+ * Runs the generation pipeline stage by stage and records timings, throughput and memory.
+ * Results are written as JSON (machine readable, usable as a baseline) and CSV (spreadsheets).
+ *
+ * Driven by UTreeBenchmarkCommandlet:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=TreeBenchmark -Iterations=6,8,10 -Seeds=1,2,3
+ */
+class LSYSTEMTREES_API FTreeBenchmark
+{
+public:
+	/** Presets from TREE_PRESETS.md */
+	static const TArray<FTreeBenchmarkPreset>& GetBuiltinPresets();
+
+	/**
+	 * Benchmark one case.
+	 * @param Preset Tree description
+	 * @param Iterations L-System iterations
+	 * @param Seed Seed for the generator and the turtle
+	 * @param Repeats Runs per case (the fastest run of each stage is kept)
+	 * @param MaxStringLength Generator string limit
+	 */
+	static FTreeBenchmarkResult RunCase(const FTreeBenchmarkPreset& Preset, int32 Iterations, int32 Seed,
+	                                    int32 Repeats, int32 MaxStringLength);
+
+	/** Serialize results (one object per case) */
+	static TSharedRef<FJsonObject> ToJson(const TArray<FTreeBenchmarkResult>& Results);
+
+	/** Write results as JSON */
+	static bool SaveJson(const TArray<FTreeBenchmarkResult>& Results, const FString& FilePath);
+
+	/** Write results as CSV (one row per case, one column per LOD timing) */
+	static bool SaveCsv(const TArray<FTreeBenchmarkResult>& Results, const FString& FilePath);
+
+	/**
+	 * Compare results against a JSON file written by an earlier run.
+	 * Cases missing from the baseline are skipped.
+	 * @param Tolerance Allowed slowdown of a stage as a fraction (0.1 = 10%)
+	 * @param OutRegressions Receives one line per regressed stage
+	 * @return False if the baseline could not be read
+	 */
+	static bool CompareToBaseline(const TArray<FTreeBenchmarkResult>& Results, const FString& BaselinePath,
+	                              double Tolerance, TArray<FString>& OutRegressions);
+};
@@ -0,0 +1,156 @@
+// TreeGenerationCache.h
+// Process-wide content-addressed cache of generated trees
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Misc/SecureHash.h"
+#include "Core/LSystem/LSystemTypes.h"
+
+class UStruct;
+
+// ============================================================================
+// FTreeGeneratedData - Shared Pipeline Output
+// ============================================================================
+
+/**
+ * Everything the generation pipeline produces for one set of inputs.
+ * Immutable once published, so components with identical inputs share one instance.
+ */
+struct LSYSTEMTREES_API FTreeGeneratedData
+{
+	/** Final L-System symbols (empty when the final iteration was streamed) */
+	FLSystemSymbolBuffer Symbols;
+
+	FTreeSkeleton Skeleton;
+	TArray<FTreeMeshData> LODs;
+
+	/** Bytes allocated by all arrays */
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * Read or write the compact binary form used by the persistent cache
+	 * (vectors stored as single precision, versioned).
+	 * @return False if loading hit a version mismatch or corrupt data
+	 */
+	bool Serialize(FArchive& Ar);
+
+	/** Shared empty instance (used instead of null so readers never need to check) */
+	static const TSharedPtr<const FTreeGeneratedData, ESPMode::ThreadSafe>& GetEmpty();
+};
+
+/** Generated tree shared by reference between components and the cache */
+using FTreeGeneratedDataPtr = TSharedPtr<const FTreeGeneratedData, ESPMode::ThreadSafe>;
+
+// ============================================================================
+// FTreeGenerationCache - Content-Addressed LRU Cache
+// ============================================================================
+
+/**
+ * Process-wide cache of generated trees keyed by a hash of every pipeline input.
+ *
+ * Entries are reference counted: eviction only drops the cache's reference, components
+ * displaying the tree keep it alive. The memory budget (LSystemTrees.TreeCache.BudgetMB,
+ * 0 disables caching) counts the entries held by the cache and evicts least recently used first.
+ *
+ * Thread-safe.
+ */
+class LSYSTEMTREES_API FTreeGenerationCache
+{
+public:
+	/** Get the process-wide cache */
+	static FTreeGenerationCache& Get();
+
+	/** Find a tree and mark it as most recently used (null on miss) */
+	FTreeGeneratedDataPtr Find(const FSHAHash& Key);
+
+	/** Add or replace a tree, then evict down to the memory budget */
+	void Add(const FSHAHash& Key, const FTreeGeneratedDataPtr& Data);
+
+	/** Drop one entry (components displaying it keep their reference) */
+	void Remove(const FSHAHash& Key);
+
+	/** Drop all entries */
+	void Empty();
+
+	/** Number of cached trees */
+	int32 Num() const;
+
+	/** Bytes held by cached trees */
+	SIZE_T GetMemoryUsage() const;
+
+	/** Current memory budget in bytes (0 = caching disabled) */
+	static SIZE_T GetBudgetBytes();
+
+	// ========================================================================
+	// Key Hashing
+	// ========================================================================
+
+	/**
+	 * Hash every reflected property of a struct (recursing into structs and arrays).
+	 * New UPROPERTYs are picked up automatically, so cache keys never miss an input.
+	 */
+	static void HashStruct(FSHA1& Hasher, const UStruct* Struct, const void* Data);
+
+	/** Hash a string by content */
+	static void HashString(FSHA1& Hasher, const FString& String);
+
+	/** Hash a plain value by its bytes */
+	template<typename T>
+	static void HashValue(FSHA1& Hasher, const T& Value)
+	{
+		Hasher.Update(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+private:
+	FTreeGenerationCache();
+
+	/** Evict least recently used entries until within the budget (lock held) */
+	void EvictToBudget(SIZE_T BudgetBytes);
+
+	mutable FCriticalSection Lock;
+
+	TLruCache<FSHAHash, FTreeGeneratedDataPtr> Entries;
+
+	SIZE_T MemoryUsage;
+};
+
+// ============================================================================
+// FTreeGenerationDiskCache - Persistent Cache
+// ============================================================================
+
+/**
+ * Persists generated trees across sessions under the same content keys as FTreeGenerationCache.
+ *
+ * Editor builds store entries in the derived data cache (shared with the team's DDC setup);
+ * cooked builds store one blob per tree under Saved/LSystemTrees/TreeCache, deleting the least
+ * recently used blobs beyond LSystemTrees.TreeCache.PersistentBudgetMB.
+ * Controlled by LSystemTrees.TreeCache.Persistent. Load blocks on disk IO, so call it from a worker
+ * unless the caller is synchronous anyway.
+ */
+class LSYSTEMTREES_API FTreeGenerationDiskCache
+{
+public:
+	/** Whether the persistent cache is enabled */
+	static bool IsEnabled();
+
+	/** Load and deserialize a tree (null on miss or corrupt data) */
+	static FTreeGeneratedDataPtr Load(const FSHAHash& Key);
+
+	/** Serialize and store a tree on a background task */
+	static void StoreAsync(const FSHAHash& Key, const FTreeGeneratedDataPtr& Data);
+
+private:
+	/** Serialize a tree to its blob form */
+	static void SaveBlob(const FTreeGeneratedData& Data, TArray<uint8>& OutBlob);
+
+#if WITH_EDITOR
+	/** Full derived data cache key for a tree */
+	static FString GetDerivedDataKey(const FSHAHash& Key);
+#else
+	/** Blob file path for a tree */
+	static FString GetBlobPath(const FSHAHash& Key);
+#endif
+};
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Core/LSystem/LSystemTypes.h"
 #include "TreeMath.generated.h"
 
 /**
@@ -180,6 +181,29 @@ public:
 	UFUNCTION(BlueprintPure, Category = "TreeMath|Geometry")
 	static float LerpRadius(float StartRadius, float EndRadius, float T);
 
+	// ========================================================================
+	// LOD Selection
+	// ========================================================================
+
+	/**
+	 * Compute the screen size of a bounding sphere (fraction of the screen it spans, same metric as UE static mesh LODs).
+	 * @param SphereRadius Radius of the bounding sphere
+	 * @param Distance Distance from the view origin to the sphere center
+	 * @param FOVDegrees Horizontal field of view in degrees
+	 * @return Screen size (1.0 = sphere diameter spans the screen)
+	 */
+	UFUNCTION(BlueprintPure, Category = "TreeMath|LOD")
+	static float ComputeScreenSize(float SphereRadius, float Distance, float FOVDegrees = 90.0f);
+
+	/**
+	 * Select the LOD for a screen size: LOD i (i > 0) is used once the screen size drops below its ScreenSize.
+	 * @param LODLevels LOD configuration (ordered from highest to lowest detail)
+	 * @param ScreenSize Current screen size
+	 * @return Selected LOD index (0 if no levels are configured)
+	 */
+	UFUNCTION(BlueprintPure, Category = "TreeMath|LOD")
+	static int32 SelectLODForScreenSize(const TArray<FTreeLODLevel>& LODLevels, float ScreenSize);
+
 	// ========================================================================
 	// Random Utilities
 	// ========================================================================
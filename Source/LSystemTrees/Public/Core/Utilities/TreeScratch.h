@@ -0,0 +1,110 @@
+// TreeScratch.h
+// Per-thread reusable buffers for the generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "Core/Utilities/TreeStats.h"
+
+/** Limits and trimming shared by all scratch pools */
+struct LSYSTEMTREES_API FTreeScratchSettings
+{
+	/** Buffers allocating more than this are freed instead of pooled (LSystemTrees.Scratch.MaxRetainedMB) */
+	static SIZE_T GetMaxRetainedBytes();
+
+	/**
+	 * Free every idle buffer (LSystemTrees.Scratch.Trim, also bound to the engine's memory trim).
+	 * Pools are per thread, so each thread drops its buffers the next time it borrows or returns one.
+	 */
+	static void Trim();
+
+	/** Incremented by Trim; pools last touched in an older epoch are emptied on their next use */
+	static uint32 GetTrimEpoch();
+
+	/** Buffers kept per type and thread */
+	static constexpr int32 MaxPooledPerThread = 4;
+};
+
+/**
+ * Borrows a buffer from the calling thread's pool for the lifetime of this object.
+ *
+ * The buffer is Reset (not Emptied) and handed back on destruction, so the next borrower on the
+ * same thread starts with its capacity: repeated generations of similar trees reach a steady state
+ * without allocator traffic for intermediate data. The pool is shared by every generator,
+ * interpreter and geometry instance running on the thread; nested borrows get distinct buffers.
+ *
+ * Only for data that dies with the stage - moving the contents out would also take the capacity.
+ * T needs Reset() and GetAllocatedSize().
+ *
+ * Usage:
+ *   TTreeScratch<TArray<int32>> Remap;
+ *   Remap->Init(INDEX_NONE, Num);
+ */
+template<typename T>
+class TTreeScratch
+{
+public:
+	TTreeScratch()
+	{
+		TArray<TUniquePtr<T>>& Pool = GetPool();
+		if (Pool.Num() > 0)
+		{
+			Buffer = Pool.Pop(false);
+			DEC_MEMORY_STAT_BY(STAT_LSystemTrees_ScratchMemory, Buffer->GetAllocatedSize());
+		}
+		else
+		{
+			Buffer = MakeUnique<T>();
+		}
+	}
+
+	~TTreeScratch()
+	{
+		TArray<TUniquePtr<T>>& Pool = GetPool();
+		Buffer->Reset();
+
+		const SIZE_T Size = Buffer->GetAllocatedSize();
+		if (Pool.Num() < FTreeScratchSettings::MaxPooledPerThread && Size <= FTreeScratchSettings::GetMaxRetainedBytes())
+		{
+			INC_MEMORY_STAT_BY(STAT_LSystemTrees_ScratchMemory, Size);
+			Pool.Push(MoveTemp(Buffer));
+		}
+	}
+
+	TTreeScratch(const TTreeScratch&) = delete;
+	TTreeScratch& operator=(const TTreeScratch&) = delete;
+
+	T& Get() const { return *Buffer; }
+	T& operator*() const { return *Buffer; }
+	T* operator->() const { return Buffer.Get(); }
+
+private:
+	struct FPool
+	{
+		TArray<TUniquePtr<T>> Buffers;
+		uint32 TrimEpoch = 0;
+	};
+
+	/** Idle buffers of the calling thread, emptied first if a trim was requested since the last use */
+	static TArray<TUniquePtr<T>>& GetPool()
+	{
+		static thread_local FPool Pool;
+
+		const uint32 TrimEpoch = FTreeScratchSettings::GetTrimEpoch();
+		if (Pool.TrimEpoch != TrimEpoch)
+		{
+			for (const TUniquePtr<T>& Idle : Pool.Buffers)
+			{
+				DEC_MEMORY_STAT_BY(STAT_LSystemTrees_ScratchMemory, Idle->GetAllocatedSize());
+			}
+			Pool.Buffers.Empty();
+			Pool.TrimEpoch = TrimEpoch;
+		}
+
+		return Pool.Buffers;
+	}
+
+	TUniquePtr<T> Buffer;
+};
@@ -0,0 +1,55 @@
+// TreeStats.h
+// Stat counters for the tree generation pipeline
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * All counters are shown by "stat LSystemTrees"; the hot paths also emit
+ * TRACE_CPUPROFILER_EVENT_SCOPE events for Unreal Insights (-trace=cpu).
+ */
+DECLARE_STATS_GROUP(TEXT("LSystemTrees"), STATGROUP_LSystemTrees, STATCAT_Advanced);
+
+// ============================================================================
+// Cycle Counters
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("L-System Stage"), STAT_LSystemTrees_LSystemStage, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Rules"), STAT_LSystemTrees_ApplyRules, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Turtle Stage"), STAT_LSystemTrees_TurtleStage, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interpret Symbols"), STAT_LSystemTrees_Interpret, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Geometry Stage"), STAT_LSystemTrees_GeometryStage, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Mesh"), STAT_LSystemTrees_BuildMesh, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Mesh Data"), STAT_LSystemTrees_ApplyMeshData, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Collision"), STAT_LSystemTrees_UpdateCollision, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+
+// ============================================================================
+// Counters
+// ============================================================================
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Trees Generated"), STAT_LSystemTrees_TreesGenerated, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cache Hits"), STAT_LSystemTrees_CacheHits, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Scheduled Trees"), STAT_LSystemTrees_ScheduledTrees, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+
+/** Stage breakdown of the most recently applied generation (any component) */
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Generation: L-System (ms)"), STAT_LSystemTrees_LastLSystemMs, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Generation: Turtle (ms)"), STAT_LSystemTrees_LastTurtleMs, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Generation: Geometry (ms)"), STAT_LSystemTrees_LastGeometryMs, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Generation: Apply (ms)"), STAT_LSystemTrees_LastApplyMs, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Generation: Total (ms)"), STAT_LSystemTrees_LastTotalMs, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+/** Bytes of generated data referenced by live tree components (shared trees count once per component) */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Symbol Memory"), STAT_LSystemTrees_SymbolMemory, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Skeleton Memory"), STAT_LSystemTrees_SkeletonMemory, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Mesh Memory"), STAT_LSystemTrees_MeshMemory, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
+
+/** Capacity held by idle per-thread scratch buffers (see TTreeScratch) */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Scratch Memory"), STAT_LSystemTrees_ScratchMemory, STATGROUP_LSystemTrees, LSYSTEMTREES_API);
@@ -11,4 +11,8 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** Frees idle scratch buffers when the engine asks for memory back */
+	FDelegateHandle MemoryTrimHandle;
 };
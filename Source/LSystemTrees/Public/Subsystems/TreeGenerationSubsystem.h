@@ -0,0 +1,114 @@
+// TreeGenerationSubsystem.h
+// Frame-budgeted scheduling of tree generation across many components
+// Part of LSystemTrees Plugin - Phase 3
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/ProceduralTreeComponent.h"
+#include "TreeGenerationSubsystem.generated.h"
+
+/**
+ * Streams tree generation for worlds with many UProceduralTreeComponents.
+ *
+ * Queued trees are started nearest-first (trees inside a player's view cone count as closer), with
+ * at most LSystemTrees.Scheduler.MaxInFlight pipelines running on worker threads at once and at most
+ * LSystemTrees.Scheduler.MaxStartsPerFrame trees taken from the queue per frame. Finished
+ * trees are applied on the game thread within LSystemTrees.Scheduler.ApplyBudgetMs per frame, so
+ * a level full of bGenerateOnStart trees streams in over several frames instead of one long hitch.
+ *
+ * Queued trees with identical inputs run the pipeline once: the others wait for it and share its
+ * result, just like a generation cache hit.
+ *
+ * Usage:
+ *   Components with bGenerateOnStart and bUseGenerationScheduler are queued automatically;
+ *   call UProceduralTreeComponent::RequestScheduledGeneration to queue one manually.
+ */
+UCLASS()
+class LSYSTEMTREES_API UTreeGenerationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// Queue
+	// ========================================================================
+
+	/** Queue a tree for generation (no-op if it is already queued) */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Scheduling")
+	void EnqueueTree(UProceduralTreeComponent* Component);
+
+	/** Remove a tree from the queue (a pipeline already running for it is cancelled by the component) */
+	UFUNCTION(BlueprintCallable, Category = "Tree|Scheduling")
+	void DequeueTree(UProceduralTreeComponent* Component);
+
+	/** Check if a tree is queued, running or waiting to be applied */
+	UFUNCTION(BlueprintPure, Category = "Tree|Scheduling")
+	bool IsTreeScheduled(const UProceduralTreeComponent* Component) const;
+
+	/** Get the number of trees queued, running or waiting to be applied */
+	UFUNCTION(BlueprintPure, Category = "Tree|Scheduling")
+	int32 GetScheduledCount() const;
+
+	/**
+	 * Hand over the result of a scheduled pipeline run (called by the component on the game thread).
+	 * @param Data Published tree, null if the pipeline failed
+	 * @param Output Stage times of the run (moved into the apply queue)
+	 */
+	void OnScheduledGenerationFinished(UProceduralTreeComponent* Component, const FTreeGenerationRequest& Request,
+	                                   const FTreeGeneratedDataPtr& Data, FTreeGenerationOutput&& Output);
+
+	// ========================================================================
+	// USubsystem / FTickableGameObject Interface
+	// ========================================================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** A pipeline run shared by every queued tree with the same cache key */
+	struct FInFlightTree
+	{
+		TWeakObjectPtr<UProceduralTreeComponent> Leader;
+
+		/** Trees waiting for the leader's result, with their own requests */
+		TArray<TPair<TWeakObjectPtr<UProceduralTreeComponent>, FTreeGenerationRequest>> Followers;
+	};
+
+	/** A finished tree waiting for its game thread upload */
+	struct FReadyTree
+	{
+		TWeakObjectPtr<UProceduralTreeComponent> Component;
+		FTreeGenerationRequest Request;
+		FTreeGeneratedDataPtr Data;
+
+		/** Stage times (null for shared results and cache hits) */
+		TSharedPtr<FTreeGenerationOutput> Output;
+	};
+
+	/** Order the queue by distance to the closest player view (nearest first) */
+	void SortQueue();
+
+	/** Start queued trees until MaxInFlight pipelines are running or MaxStartsPerFrame trees were taken */
+	void LaunchQueued();
+
+	/** Upload finished trees until the frame budget is spent (at least one per frame) */
+	void ApplyReady();
+
+	/** Return the followers of a run that will never finish to the queue */
+	void RequeueFollowers(FInFlightTree& Run);
+
+	/** Trees waiting to start, nearest first (enqueue order without player views) */
+	TArray<TWeakObjectPtr<UProceduralTreeComponent>> Queue;
+
+	/** Running pipelines by cache key */
+	TMap<FSHAHash, FInFlightTree> InFlight;
+
+	/** Finished trees in completion order */
+	TArray<FReadyTree> Ready;
+};